@@ -27,6 +27,9 @@
 
 #include <memory> /* :( */
 #include <pybind11/pybind11.h>
+#include <Corrade/Containers/Array.h>
+
+#include "Corrade/Python.h"
 
 namespace Corrade { namespace Containers {
 
@@ -48,9 +51,30 @@ template<class T> PyArrayViewHolder<T> pyArrayViewHolder(const T& view, pybind11
     return PyArrayViewHolder<T>{new T{view}, owner};
 }
 
+/* Holder for owning arrays. Counts active buffer protocol exports so the data
+   can't be moved out while something such as a memoryview still points to
+   it. */
+template<class T> struct PyArrayHolder: std::unique_ptr<T> {
+    explicit PyArrayHolder(T* object): std::unique_ptr<T>{object} {}
+
+    std::size_t exportCount{};
+};
+
+/* Moves the data out of an array owned by Python, leaving an empty array
+   behind. Used for passing arrays to C++ APIs that take ownership. */
+template<class T> Array<T> pyArrayMove(Array<T>& array) {
+    if(pyObjectHolderFor<PyArrayHolder>(array).exportCount) {
+        PyErr_SetString(PyExc_BufferError, "array data is exported to a buffer, can't move it");
+        throw pybind11::error_already_set{};
+    }
+
+    return std::move(array);
+}
+
 }}
 
 PYBIND11_DECLARE_HOLDER_TYPE(T, Corrade::Containers::PyArrayViewHolder<T>)
+PYBIND11_DECLARE_HOLDER_TYPE(T, Corrade::Containers::PyArrayHolder<T>)
 
 #endif
 
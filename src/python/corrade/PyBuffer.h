@@ -35,11 +35,26 @@
 
 namespace corrade {
 
+/* One-letter item format of a buffer with a native or explicitly native byte
+   order prefix stripped, or 0 if the format is anything more complex or has
+   a non-native byte order. No format means unsigned bytes. */
+inline char pyBufferFormatCharacter(const Py_buffer& buffer) {
+    const char* format = buffer.format ? buffer.format : "B";
+    if(*format == '@' || *format == '=' ||
+        #ifndef CORRADE_TARGET_BIG_ENDIAN
+        *format == '<'
+        #else
+        *format == '>'
+        #endif
+    ) ++format;
+    return format[0] && !format[1] ? format[0] : 0;
+}
+
 /* pybind's py::buffer_info is EXTREMELY USELESS IT HURTS (and also allocates
    like hell), doing my own thing here instead. IMAGINE, I can pass flags to
    say what features I'm able to USE! WOW! */
 
-template<class Class, bool(*getter)(Class&, Py_buffer&, int)> void enableBetterBufferProtocol(py::object& object) {
+template<class Class, bool(*getter)(Class&, Py_buffer&, int), void(*releaser)(Class&, Py_buffer&) = nullptr> void enableBetterBufferProtocol(py::object& object) {
     auto& typeObject = reinterpret_cast<PyHeapTypeObject&>(*object.ptr());
     /* Sanity check -- we expect pybind set up its own buffer functions before
        us */
@@ -70,9 +85,13 @@ template<class Class, bool(*getter)(Class&, Py_buffer&, int)> void enableBetterB
         Py_INCREF(buffer->obj);
         return 0;
     };
-    /* No need to release anything, we haven't made any garbage in the first
-       place */
-    typeObject.as_buffer.bf_releasebuffer = nullptr;
+    /* Usually there's no need to release anything, we haven't made any
+       garbage in the first place. Classes that need to track their exports
+       supply a releaser. */
+    if(releaser) typeObject.as_buffer.bf_releasebuffer = [](PyObject *obj, Py_buffer *buffer) {
+        releaser(pyInstanceFromHandle<Class>(obj), *buffer);
+    };
+    else typeObject.as_buffer.bf_releasebuffer = nullptr;
 }
 
 }
@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <unordered_map>
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h> /* so ArrayView is convertible from python array */
 #include <Corrade/Containers/Array.h>
@@ -41,9 +42,64 @@ const char* const FormatStrings[]{
     /* 0. Representing bytes as unsigned. Not using 'c' because then it behaves
        differently from bytes/bytearray, where you can do `a[0] = ord('A')`. */
     "B",
+
+    "H", /* 1 -- std::uint16_t */
+    "i", /* 2 -- std::int32_t */
+    "I", /* 3 -- std::uint32_t */
+    "f", /* 4 -- float */
+    "d"  /* 5 -- double */
 };
 template<class> constexpr std::size_t formatIndex();
 template<> constexpr std::size_t formatIndex<char>() { return 0; }
+template<> constexpr std::size_t formatIndex<std::uint16_t>() { return 1; }
+template<> constexpr std::size_t formatIndex<std::int32_t>() { return 2; }
+template<> constexpr std::size_t formatIndex<std::uint32_t>() { return 3; }
+template<> constexpr std::size_t formatIndex<float>() { return 4; }
+template<> constexpr std::size_t formatIndex<double>() { return 5; }
+
+/* Format characters accepted for given type, in addition to the item size
+   being checked. Python's array and struct modules are using 'l' for 32-bit
+   integers on some platforms. */
+template<class> constexpr bool isFormatCharacterCompatible(char);
+template<> constexpr bool isFormatCharacterCompatible<std::uint16_t>(char format) {
+    return format == 'H';
+}
+template<> constexpr bool isFormatCharacterCompatible<std::int32_t>(char format) {
+    return format == 'i' || format == 'l';
+}
+template<> constexpr bool isFormatCharacterCompatible<std::uint32_t>(char format) {
+    return format == 'I' || format == 'L';
+}
+template<> constexpr bool isFormatCharacterCompatible<float>(char format) {
+    return format == 'f';
+}
+template<> constexpr bool isFormatCharacterCompatible<double>(char format) {
+    return format == 'd';
+}
+
+/* Bytes are a fallback for everything, so there the format isn't checked at
+   all to keep the ArrayView(b'...') and friends working */
+template<class T> bool isFormatCompatible(const Py_buffer& buffer) {
+    if(buffer.itemsize != sizeof(T) || !buffer.format) return false;
+
+    /* Expecting just an one-letter format in native byte order */
+    const char format = pyBufferFormatCharacter(buffer);
+    return format && isFormatCharacterCompatible<T>(format);
+}
+template<> bool isFormatCompatible<char>(const Py_buffer&) { return true; }
+
+/* Memory owner for a non-empty view on a buffer object. Views on an owning
+   Array reference it through a memoryview instead of directly, which keeps
+   the buffer export counted for the whole lifetime of the view so the data
+   can't be moved out from under it. */
+py::object viewOwner(PyObject* obj) {
+    if(!py::isinstance<Containers::Array<char>>(obj))
+        return py::reinterpret_borrow<py::object>(obj);
+
+    PyObject* view = PyMemoryView_FromObject(obj);
+    if(!view) throw py::error_already_set{};
+    return py::reinterpret_steal<py::object>(view);
+}
 
 struct Slice {
     std::size_t start;
@@ -70,8 +126,55 @@ Slice calculateSlice(py::slice slice, std::size_t containerSize) {
     return Slice{std::size_t(start), std::size_t(stop), step};
 }
 
+/* Bulk operations on more than this many bytes release the GIL, for smaller
+   sizes the overhead of releasing and reacquiring isn't worth it */
+constexpr std::size_t ReleaseGilThreshold = 65536;
+
+/* Buffer export on an owner of a view. Views don't hold one, so without it
+   another thread could for example resize a bytearray under the view while
+   the GIL is released. Owners that aren't buffers can't be resized that way
+   and are skipped. */
+class PyOwnerExport {
+    public:
+        explicit PyOwnerExport(py::handle owner) {
+            if(!owner || owner.is_none()) return;
+            if(PyObject_GetBuffer(owner.ptr(), &_buffer, PyBUF_RECORDS_RO) != 0) {
+                PyErr_Clear();
+                return;
+            }
+            _exported = true;
+        }
+
+        ~PyOwnerExport() {
+            if(_exported) PyBuffer_Release(&_buffer);
+        }
+
+        PyOwnerExport(const PyOwnerExport&) = delete;
+        PyOwnerExport& operator=(const PyOwnerExport&) = delete;
+
+    private:
+        /* GCC 4.8 otherwise loudly complains about missing initializers */
+        Py_buffer _buffer{nullptr, nullptr, 0, 0, 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr};
+        bool _exported{};
+};
+
+/* The owners of all views the operation touches are exported for as long as
+   the GIL is released. The exports are declared before the GIL release so
+   they're dropped only after the GIL is acquired again. */
+template<class F> void releaseGilIfLarge(std::size_t bytes, py::handle owner, py::handle otherOwner, F&& f) {
+    if(bytes >= ReleaseGilThreshold) {
+        PyOwnerExport ownerExport{owner}, otherOwnerExport{otherOwner};
+        py::gil_scoped_release release;
+        f();
+    } else f();
+}
+
+template<class T> py::handle viewOwnerOf(const T& view) {
+    return pyObjectHolderFor<Containers::PyArrayViewHolder>(const_cast<T&>(view)).owner;
+}
+
 template<class T> bool arrayViewBufferProtocol(T& self, Py_buffer& buffer, int flags) {
-    if((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE && !std::is_const<typename T::Type>::value) {
+    if((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE && std::is_const<typename T::Type>::value) {
         PyErr_SetString(PyExc_BufferError, "array view is not writable");
         return false;
     }
@@ -110,7 +213,7 @@ template<class T> void arrayView(py::class_<Containers::ArrayView<T>, Containers
         .def(py::init([](py::buffer other) {
             /* GCC 4.8 otherwise loudly complains about missing initializers */
             Py_buffer buffer{nullptr, nullptr, 0, 0, 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr};
-            if(PyObject_GetBuffer(other.ptr(), &buffer, (std::is_const<T>::value ? 0 : PyBUF_WRITABLE)) != 0)
+            if(PyObject_GetBuffer(other.ptr(), &buffer, PyBUF_FORMAT|(std::is_const<T>::value ? 0 : PyBUF_WRITABLE)) != 0)
                 throw py::error_already_set{};
 
             Containers::ScopeGuard e{&buffer, PyBuffer_Release};
@@ -118,6 +221,11 @@ template<class T> void arrayView(py::class_<Containers::ArrayView<T>, Containers
             /* I would test for dimensions here but np.array() sometimes gives
                0 for an one-dimensional array so ¯\_(ツ)_/¯ */
 
+            if(!isFormatCompatible<typename std::decay<T>::type>(buffer)) {
+                PyErr_Format(PyExc_BufferError, "expected format %s but got %s", FormatStrings[formatIndex<typename std::decay<T>::type>()], buffer.format ? buffer.format : "B");
+                throw py::error_already_set{};
+            }
+
             if(buffer.strides && buffer.strides[0] != buffer.itemsize) {
                 PyErr_Format(PyExc_BufferError, "expected stride of %zi but got %zi", buffer.itemsize, buffer.strides[0]);
                 throw py::error_already_set{};
@@ -127,8 +235,8 @@ template<class T> void arrayView(py::class_<Containers::ArrayView<T>, Containers
                refcounted) py::object. We take the underlying object instead of
                the buffer because we no longer care about the buffer
                descriptor -- that could allow the GC to haul away a bit more
-               garbage */
-            return Containers::pyArrayViewHolder(Containers::ArrayView<T>{static_cast<T*>(buffer.buf), std::size_t(buffer.len)}, buffer.len ? py::reinterpret_borrow<py::object>(buffer.obj) : py::none{});
+               garbage. Owning arrays are an exception, see viewOwner(). */
+            return Containers::pyArrayViewHolder(Containers::ArrayView<T>{static_cast<T*>(buffer.buf), std::size_t(buffer.len)/sizeof(T)}, buffer.len ? viewOwner(buffer.obj) : py::none{});
         }), "Construct from a buffer")
 
         /* Length and memory owning object */
@@ -139,7 +247,7 @@ template<class T> void arrayView(py::class_<Containers::ArrayView<T>, Containers
 
         /* Conversion to bytes */
         .def("__bytes__", [](const Containers::ArrayView<T>& self) {
-            return py::bytes(self.data(), self.size());
+            return py::bytes(reinterpret_cast<const char*>(self.data()), self.size()*sizeof(T));
         }, "Convert to bytes")
 
         /* Single item retrieval. Need to raise IndexError in order to allow
@@ -178,7 +286,25 @@ template<class T> void mutableArrayView(py::class_<Containers::ArrayView<T>, Con
                 throw py::error_already_set{};
             }
             self[i] = value;
-        }, "Set a value at given position");
+        }, "Set a value at given position")
+
+        /* Bulk operations. The view is always contiguous, so these can be
+           done at once. */
+        .def("fill", [](const Containers::ArrayView<T>& self, const T& value) {
+            releaseGilIfLarge(self.size()*sizeof(T), viewOwnerOf(self), {}, [&]() {
+                std::fill_n(self.data(), self.size(), value);
+            });
+        }, "Fill the view with given value", py::arg("value"))
+        .def("copy_from", [](const Containers::ArrayView<T>& self, const Containers::ArrayView<const T>& other) {
+            if(other.size() != self.size()) {
+                PyErr_Format(PyExc_ValueError, "expected a view of %zu items but got %zu", self.size(), other.size());
+                throw py::error_already_set{};
+            }
+            releaseGilIfLarge(self.size()*sizeof(T), viewOwnerOf(self), viewOwnerOf(other), [&]() {
+                /* The views can overlap */
+                std::memmove(self.data(), other.data(), self.size()*sizeof(T));
+            });
+        }, "Copy contents of another view", py::arg("other"));
 }
 
 /* Tuple for given dimension */
@@ -218,37 +344,172 @@ template<> std::tuple<std::ptrdiff_t, std::ptrdiff_t, std::ptrdiff_t, std::ptrdi
     return std::make_tuple(stride[0], stride[1], stride[2], stride[3]);
 }
 
-/* Byte conversion for given dimension */
-template<unsigned dimensions> Containers::Array<char> bytes(Containers::StridedArrayView<dimensions, const char>);
-template<> Containers::Array<char> bytes(Containers::StridedArrayView1D<const char> view) {
-    Containers::Array<char> out{view.size()};
-    std::size_t pos = 0;
-    for(const char i: view) out[pos++] = i;
-    return out;
-}
-template<> Containers::Array<char> bytes(Containers::StridedArrayView2D<const char> view) {
-    Containers::Array<char> out{view.size()[0]*view.size()[1]};
-    std::size_t pos = 0;
-    for(Containers::StridedArrayView1D<const char> i: view)
-        for(const char j: i) out[pos++] = j;
-    return out;
-}
-template<> Containers::Array<char> bytes(Containers::StridedArrayView3D<const char> view) {
-    Containers::Array<char> out{view.size()[0]*view.size()[1]*view.size()[2]};
-    std::size_t pos = 0;
-    for(Containers::StridedArrayView2D<const char> i: view)
-        for(Containers::StridedArrayView1D<const char> j: i)
-            for(const char k: j) out[pos++] = k;
-    return out;
-}
-template<> Containers::Array<char> bytes(Containers::StridedArrayView<4, const char> view) {
-    Containers::Array<char> out{view.size()[0]*view.size()[1]*view.size()[2]*view.size()[3]};
-    std::size_t pos = 0;
-    for(Containers::StridedArrayView3D<const char> i: view)
-        for(Containers::StridedArrayView2D<const char> j: i)
-            for(Containers::StridedArrayView1D<const char> k: j)
-                for(const char l: k) out[pos++] = l;
-    return out;
+/* Whether the view is C-contiguous, i.e. the strides are exactly what a
+   tightly packed row-major array of the same size would have. Dimensions of
+   size 1 can have an arbitrary stride, as that doesn't affect the layout. */
+template<unsigned dimensions, class T> bool isContiguous(const Containers::StridedArrayView<dimensions, T>& view) {
+    const Containers::StridedDimensions<dimensions, std::size_t> size{view.size()};
+    const Containers::StridedDimensions<dimensions, std::ptrdiff_t> stride{view.stride()};
+    std::ptrdiff_t expected = sizeof(T);
+    for(std::size_t i = dimensions; i != 0; --i) {
+        /* An empty view is contiguous, no matter what the strides are */
+        if(!size[i - 1]) return true;
+        if(size[i - 1] != 1 && stride[i - 1] != expected) return false;
+        expected *= size[i - 1];
+    }
+    return true;
+}
+
+/* Same as above, but column-major, which is what a transposed() C-contiguous
+   view is */
+template<unsigned dimensions, class T> bool isFortranContiguous(const Containers::StridedArrayView<dimensions, T>& view) {
+    const Containers::StridedDimensions<dimensions, std::size_t> size{view.size()};
+    const Containers::StridedDimensions<dimensions, std::ptrdiff_t> stride{view.stride()};
+    std::ptrdiff_t expected = sizeof(T);
+    for(std::size_t i = 0; i != dimensions; ++i) {
+        if(!size[i]) return true;
+        if(size[i] != 1 && stride[i] != expected) return false;
+        expected *= size[i];
+    }
+    return true;
+}
+
+/* Byte conversion for given dimension. If the innermost dimension is
+   contiguous, whole rows are copied at once, otherwise it goes item by item.
+   Copying whole items instead of going through arrayCast<const char>() as
+   that would take just the first byte of each item for non-byte types. */
+template<class T> void bytesInto(const Containers::StridedArrayView1D<T>& view, char*& out) {
+    if(view.stride() == std::ptrdiff_t(sizeof(T))) {
+        std::memcpy(out, view.data(), view.size()*sizeof(T));
+        out += view.size()*sizeof(T);
+        return;
+    }
+
+    for(T& i: view) {
+        std::memcpy(out, &i, sizeof(T));
+        out += sizeof(T);
+    }
+}
+template<unsigned dimensions, class T> void bytesInto(const Containers::StridedArrayView<dimensions, T>& view, char*& out) {
+    for(const Containers::StridedArrayView<dimensions - 1, T> i: view)
+        bytesInto(i, out);
+}
+template<unsigned dimensions, class T> py::bytes bytes(const Containers::StridedArrayView<dimensions, T>& view) {
+    const Containers::StridedDimensions<dimensions, std::size_t> size{view.size()};
+    std::size_t count = sizeof(T);
+    for(std::size_t i = 0; i != dimensions; ++i) count *= size[i];
+
+    /* Filling the bytes object directly instead of going through a temporary
+       array. Nobody else sees the object until it's returned, so modifying it
+       in-place is fine. */
+    PyObject* out = PyBytes_FromStringAndSize(nullptr, count);
+    if(!out) throw py::error_already_set{};
+    char* pos = PyBytes_AS_STRING(out);
+
+    /* If the whole view is contiguous, it's just a single copy */
+    if(isContiguous(view)) {
+        std::memcpy(pos, view.data(), count);
+        pos += count;
+    } else bytesInto(view, pos);
+
+    CORRADE_INTERNAL_ASSERT(pos == PyBytes_AS_STRING(out) + count);
+    return py::reinterpret_steal<py::bytes>(out);
+}
+
+/* Bulk operations for given dimension. If the views are contiguous, these are
+   done on the whole range at once, or at least on whole rows, which gives the
+   compiler a chance to vectorize the loops. */
+template<class T> void fillInto(const Containers::StridedArrayView1D<T>& view, const T& value) {
+    if(view.stride() == std::ptrdiff_t(sizeof(T))) {
+        std::fill_n(static_cast<T*>(view.data()), view.size(), value);
+        return;
+    }
+
+    for(T& i: view) i = value;
+}
+template<unsigned dimensions, class T> void fillInto(const Containers::StridedArrayView<dimensions, T>& view, const T& value) {
+    for(const Containers::StridedArrayView<dimensions - 1, T> i: view)
+        fillInto(i, value);
+}
+
+template<class T, class U> void copyInto(const Containers::StridedArrayView1D<T>& src, const Containers::StridedArrayView1D<U>& dst) {
+    if(src.stride() == std::ptrdiff_t(sizeof(T)) && dst.stride() == std::ptrdiff_t(sizeof(U))) {
+        const T* srcData = static_cast<const T*>(src.data());
+        U* dstData = static_cast<U*>(dst.data());
+        for(std::size_t i = 0, end = src.size(); i != end; ++i)
+            dstData[i] = U(srcData[i]);
+        return;
+    }
+
+    for(std::size_t i = 0, end = src.size(); i != end; ++i)
+        dst[i] = U(src[i]);
+}
+template<unsigned dimensions, class T, class U> void copyInto(const Containers::StridedArrayView<dimensions, T>& src, const Containers::StridedArrayView<dimensions, U>& dst) {
+    for(std::size_t i = 0, end = Containers::StridedDimensions<dimensions, std::size_t>{src.size()}[0]; i != end; ++i)
+        copyInto(src[i], dst[i]);
+}
+
+/* Memory spanned by a view, in bytes. Used to detect overlapping views. */
+template<unsigned dimensions, class T> std::pair<const char*, const char*> memoryRange(const Containers::StridedArrayView<dimensions, T>& view) {
+    const Containers::StridedDimensions<dimensions, std::size_t> size{view.size()};
+    const Containers::StridedDimensions<dimensions, std::ptrdiff_t> stride{view.stride()};
+    const char* begin = static_cast<const char*>(view.data());
+    const char* end = begin + sizeof(T);
+    for(std::size_t i = 0; i != dimensions; ++i) {
+        if(!size[i]) return {begin, begin};
+        const std::ptrdiff_t offset = std::ptrdiff_t(size[i] - 1)*stride[i];
+        if(offset < 0) begin += offset;
+        else end += offset;
+    }
+    return {begin, end};
+}
+
+template<unsigned dimensions, class T, class U> bool overlaps(const Containers::StridedArrayView<dimensions, T>& a, const Containers::StridedArrayView<dimensions, U>& b) {
+    const std::pair<const char*, const char*> aRange = memoryRange(a);
+    const std::pair<const char*, const char*> bRange = memoryRange(b);
+    return aRange.first < bRange.second && bRange.first < aRange.second;
+}
+
+/* copyInto() goes forward in every dimension, so for overlapping views it
+   could overwrite items before reading them. Copy the source into a
+   contiguous temporary first in that case. */
+template<unsigned dimensions, class T, class U> void copyIntoOverlapping(const Containers::StridedArrayView<dimensions, T>& src, const Containers::StridedArrayView<dimensions, U>& dst) {
+    if(!overlaps(src, dst)) {
+        copyInto(src, dst);
+        return;
+    }
+
+    typedef typename std::remove_const<T>::type Type;
+    const Containers::StridedDimensions<dimensions, std::size_t> size{src.size()};
+    Containers::StridedDimensions<dimensions, std::ptrdiff_t> stride;
+    std::size_t count = 1;
+    for(std::size_t i = dimensions; i != 0; --i) {
+        stride[i - 1] = std::ptrdiff_t(count*sizeof(Type));
+        count *= size[i - 1];
+    }
+
+    Containers::Array<Type> temporary{Containers::NoInit, count};
+    const Containers::StridedArrayView<dimensions, Type> temporaryView{
+        {temporary.data(), count}, size, stride};
+    copyInto(src, temporaryView);
+    copyInto(temporaryView, dst);
+}
+
+template<unsigned dimensions, class T, class U> void checkSameSize(const Containers::StridedArrayView<dimensions, T>& a, const Containers::StridedArrayView<dimensions, U>& b) {
+    const Containers::StridedDimensions<dimensions, std::size_t> aSize{a.size()};
+    const Containers::StridedDimensions<dimensions, std::size_t> bSize{b.size()};
+    for(std::size_t i = 0; i != dimensions; ++i) {
+        if(aSize[i] == bSize[i]) continue;
+        PyErr_Format(PyExc_ValueError, "expected a view of %zu items in dimension %zu but got %zu", aSize[i], i, bSize[i]);
+        throw py::error_already_set{};
+    }
+}
+
+template<unsigned dimensions, class T> std::size_t byteSize(const Containers::StridedArrayView<dimensions, T>& view) {
+    const Containers::StridedDimensions<dimensions, std::size_t> size{view.size()};
+    std::size_t count = sizeof(T);
+    for(std::size_t i = 0; i != dimensions; ++i) count *= size[i];
+    return count;
 }
 
 /* Getting a runtime tuple index. Ugh. */
@@ -276,13 +537,28 @@ template<class T> const T& dimensionsTupleGet(const typename DimensionsTuple<4,
 }
 
 template<class T> bool stridedArrayViewBufferProtocol(T& self, Py_buffer& buffer, int flags) {
-    if((flags & PyBUF_STRIDES) != PyBUF_STRIDES) {
-        /* TODO: allow this if the array actually *is* contiguous? */
-        PyErr_SetString(PyExc_BufferError, "array view is not contiguous");
-        return false;
+    /* Consumers that can't handle strides get the view only if it's
+       contiguous. Those that can handle strides but explicitly ask for a
+       particular contiguity need to be checked as well. */
+    if((flags & PyBUF_STRIDES) != PyBUF_STRIDES ||
+       (flags & PyBUF_C_CONTIGUOUS) == PyBUF_C_CONTIGUOUS) {
+        if(!isContiguous(self)) {
+            PyErr_SetString(PyExc_BufferError, "array view is not contiguous");
+            return false;
+        }
+    } else if((flags & PyBUF_F_CONTIGUOUS) == PyBUF_F_CONTIGUOUS) {
+        if(!isFortranContiguous(self)) {
+            PyErr_SetString(PyExc_BufferError, "array view is not Fortran contiguous");
+            return false;
+        }
+    } else if((flags & PyBUF_ANY_CONTIGUOUS) == PyBUF_ANY_CONTIGUOUS) {
+        if(!isContiguous(self) && !isFortranContiguous(self)) {
+            PyErr_SetString(PyExc_BufferError, "array view is not contiguous");
+            return false;
+        }
     }
 
-    if((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE && !std::is_const<typename T::Type>::value) {
+    if((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE && std::is_const<typename T::Type>::value) {
         PyErr_SetString(PyExc_BufferError, "array view is not writable");
         return false;
     }
@@ -299,9 +575,13 @@ template<class T> bool stridedArrayViewBufferProtocol(T& self, Py_buffer& buffer
     if((flags & PyBUF_FORMAT) == PyBUF_FORMAT)
         buffer.format = const_cast<char*>(FormatStrings[formatIndex<typename std::decay<typename T::Type>::type>()]);
     /* The view is immutable (can't change its size after it has been
-       constructed), so referencing the size/stride directly is okay */
-    buffer.shape = const_cast<Py_ssize_t*>(reinterpret_cast<const Py_ssize_t*>(Containers::Implementation::sizeRef(self).begin()));
-    buffer.strides = const_cast<Py_ssize_t*>(reinterpret_cast<const Py_ssize_t*>(Containers::Implementation::strideRef(self).begin()));
+       constructed), so referencing the size/stride directly is okay. A
+       simple buffer is just a flat range of bytes without any shape. */
+    if((flags & PyBUF_ND) == PyBUF_ND)
+        buffer.shape = const_cast<Py_ssize_t*>(reinterpret_cast<const Py_ssize_t*>(Containers::Implementation::sizeRef(self).begin()));
+    else buffer.ndim = 1;
+    if((flags & PyBUF_STRIDES) == PyBUF_STRIDES)
+        buffer.strides = const_cast<Py_ssize_t*>(reinterpret_cast<const Py_ssize_t*>(Containers::Implementation::strideRef(self).begin()));
 
     return true;
 }
@@ -310,6 +590,22 @@ inline std::size_t largerStride(std::size_t a, std::size_t b) {
     return a < b ? b : a; /* max(), but named like this to avoid clashes */
 }
 
+/* Creates a view from a runtime size and stride, used by the mixed indexing
+   below where the resulting dimension count isn't known upfront */
+template<unsigned dimensions, class T> py::object pyStridedArrayView(T* data, const std::size_t* size, const std::ptrdiff_t* stride, py::object owner) {
+    Containers::StridedDimensions<dimensions, std::size_t> outSize;
+    Containers::StridedDimensions<dimensions, std::ptrdiff_t> outStride;
+    std::size_t span = 0;
+    for(std::size_t i = 0; i != dimensions; ++i) {
+        outSize[i] = size[i];
+        outStride[i] = stride[i];
+        span = largerStride(size[i]*(stride[i] < 0 ? -stride[i] : stride[i]), span);
+    }
+
+    return pyCastButNotShitty(Containers::pyArrayViewHolder(Containers::StridedArrayView<dimensions, T>{
+        {data, (span + sizeof(T) - 1)/sizeof(T)}, outSize, outStride}, std::move(owner)));
+}
+
 template<unsigned dimensions, class T> void stridedArrayView(py::class_<Containers::StridedArrayView<dimensions, T>, Containers::PyArrayViewHolder<Containers::StridedArrayView<dimensions, T>>>& c) {
     /* Implicitly convertible from a buffer */
     py::implicitly_convertible<py::buffer, Containers::StridedArrayView<dimensions, T>>();
@@ -324,7 +620,7 @@ template<unsigned dimensions, class T> void stridedArrayView(py::class_<Containe
         .def(py::init([](py::buffer other) {
             /* GCC 4.8 otherwise loudly complains about missing initializers */
             Py_buffer buffer{nullptr, nullptr, 0, 0, 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr};
-            if(PyObject_GetBuffer(other.ptr(), &buffer, PyBUF_STRIDES|(std::is_const<T>::value ? 0 : PyBUF_WRITABLE)) != 0)
+            if(PyObject_GetBuffer(other.ptr(), &buffer, PyBUF_STRIDES|PyBUF_FORMAT|(std::is_const<T>::value ? 0 : PyBUF_WRITABLE)) != 0)
                 throw py::error_already_set{};
 
             Containers::ScopeGuard e{&buffer, PyBuffer_Release};
@@ -334,6 +630,11 @@ template<unsigned dimensions, class T> void stridedArrayView(py::class_<Containe
                 throw py::error_already_set{};
             }
 
+            if(!isFormatCompatible<typename std::decay<T>::type>(buffer)) {
+                PyErr_Format(PyExc_BufferError, "expected format %s but got %s", FormatStrings[formatIndex<typename std::decay<T>::type>()], buffer.format ? buffer.format : "B");
+                throw py::error_already_set{};
+            }
+
             Containers::StaticArrayView<dimensions, const std::size_t> sizes{reinterpret_cast<std::size_t*>(buffer.shape)};
             Containers::StaticArrayView<dimensions, const std::ptrdiff_t> strides{reinterpret_cast<std::ptrdiff_t*>(buffer.strides)};
             /* Calculate total memory size that spans the whole view. Mainly to
@@ -346,12 +647,12 @@ template<unsigned dimensions, class T> void stridedArrayView(py::class_<Containe
                refcounted) py::object. We take the underlying object instead of
                the buffer because we no longer care about the buffer
                descriptor -- that could allow the GC to haul away a bit more
-               garbage */
+               garbage. Owning arrays are an exception, see viewOwner(). */
             return Containers::pyArrayViewHolder(Containers::StridedArrayView<dimensions, T>{
-                {static_cast<T*>(buffer.buf), size},
+                {static_cast<T*>(buffer.buf), (size + sizeof(T) - 1)/sizeof(T)},
                 Containers::StaticArrayView<dimensions, const std::size_t>{reinterpret_cast<std::size_t*>(buffer.shape)},
                 Containers::StaticArrayView<dimensions, const std::ptrdiff_t>{reinterpret_cast<std::ptrdiff_t*>(buffer.strides)}},
-                buffer.len ? py::reinterpret_borrow<py::object>(buffer.obj) : py::none{});
+                buffer.len ? viewOwner(buffer.obj) : py::none{});
         }), "Construct from a buffer")
 
         /* Length, size/stride tuple, dimension count and memory owning object */
@@ -371,9 +672,7 @@ template<unsigned dimensions, class T> void stridedArrayView(py::class_<Containe
 
         /* Conversion to bytes */
         .def("__bytes__", [](const Containers::StridedArrayView<dimensions, T>& self) {
-            /* TODO: use _PyBytes_Resize() to avoid the double copy */
-            const Containers::Array<char> out = bytes(Containers::arrayCast<const char>(self));
-            return py::bytes(out.data(), out.size());
+            return bytes(self);
         }, "Convert to bytes")
 
         /* Slicing of the top dimension */
@@ -396,7 +695,16 @@ template<class T> void stridedArrayView1D(py::class_<Containers::StridedArrayVie
                 throw py::error_already_set{};
             }
             return self[i];
-        }, "Value at given position");
+        }, "Value at given position")
+
+        /* Sub-view */
+        .def("sub", [](const Containers::StridedArrayView<1, T>& self, std::size_t offset, std::size_t size) {
+            if(offset + size > self.size()) {
+                PyErr_Format(PyExc_IndexError, "sub-view [%zu:%zu] out of range for %zu elements", offset, offset + size, self.size());
+                throw py::error_already_set{};
+            }
+            return Containers::pyArrayViewHolder(self.slice(offset, offset + size), size ? pyObjectHolderFor<Containers::PyArrayViewHolder>(self).owner : py::none{});
+        }, "Sub-view of given offset and size", py::arg("offset"), py::arg("size"));
 }
 
 template<unsigned dimensions, class T> void stridedArrayViewND(py::class_<Containers::StridedArrayView<dimensions, T>, Containers::PyArrayViewHolder<Containers::StridedArrayView<dimensions, T>>>& c) {
@@ -429,7 +737,120 @@ template<unsigned dimensions, class T> void stridedArrayViewND(py::class_<Contai
 
             const auto sliced = self.slice(starts, stops).every(steps);
             return Containers::pyArrayViewHolder(sliced, empty ? py::none{} : pyObjectHolderFor<Containers::PyArrayViewHolder>(self).owner);
-        }, "Slice the view");
+        }, "Slice the view")
+
+        /* Mixed integer, slice and ellipsis indexing. The resulting size and
+           stride is calculated in a single pass and only the final view is
+           created, integer indices drop the corresponding dimension. */
+        .def("__getitem__", [](const Containers::StridedArrayView<dimensions, T>& self, py::tuple indices) -> py::object {
+            typedef typename std::conditional<std::is_const<T>::value, const char, char>::type Byte;
+
+            /* Count the actual indices, an ellipsis expands to all the
+               remaining dimensions */
+            std::size_t indexCount = 0;
+            bool hasEllipsis = false;
+            for(py::handle index: indices) {
+                if(index.ptr() != Py_Ellipsis) {
+                    ++indexCount;
+                    continue;
+                }
+
+                if(hasEllipsis) {
+                    PyErr_SetString(PyExc_IndexError, "an index can only have a single ellipsis");
+                    throw py::error_already_set{};
+                }
+                hasEllipsis = true;
+            }
+            if(indexCount > dimensions) {
+                PyErr_Format(PyExc_IndexError, "too many indices for a %u-dimensional view", dimensions);
+                throw py::error_already_set{};
+            }
+
+            const Containers::StridedDimensions<dimensions, std::size_t> size{self.size()};
+            const Containers::StridedDimensions<dimensions, std::ptrdiff_t> stride{self.stride()};
+            Byte* data = static_cast<Byte*>(self.data());
+            std::size_t outSize[dimensions];
+            std::ptrdiff_t outStride[dimensions];
+            std::size_t outDimensions = 0;
+            bool empty = false;
+
+            /* Dimensions not covered by the indices are taken whole as if
+               there was an ellipsis at the end */
+            std::size_t dimension = 0;
+            auto takeWhole = [&](std::size_t count) {
+                for(std::size_t end = dimension + count; dimension != end; ++dimension) {
+                    outSize[outDimensions] = size[dimension];
+                    outStride[outDimensions] = stride[dimension];
+                    if(!size[dimension]) empty = true;
+                    ++outDimensions;
+                }
+            };
+            for(py::handle index: indices) {
+                if(index.ptr() == Py_Ellipsis) {
+                    takeWhole(dimensions - indexCount);
+
+                } else if(py::isinstance<py::slice>(index)) {
+                    const Slice calculated = calculateSlice(py::reinterpret_borrow<py::slice>(index), size[dimension]);
+                    const std::size_t absStep = calculated.step < 0 ? -calculated.step : calculated.step;
+                    const std::size_t count = (calculated.stop - calculated.start + absStep - 1)/absStep;
+                    /* Negative step starts at the end, same as every() */
+                    if(count) data += std::ptrdiff_t(calculated.step < 0 ? calculated.stop - 1 : calculated.start)*stride[dimension];
+                    else empty = true;
+                    outSize[outDimensions] = count;
+                    outStride[outDimensions] = stride[dimension]*calculated.step;
+                    ++outDimensions;
+                    ++dimension;
+
+                } else if(PyLong_Check(index.ptr())) {
+                    std::ptrdiff_t i = PyLong_AsSsize_t(index.ptr());
+                    if(i == -1 && PyErr_Occurred()) throw py::error_already_set{};
+                    /* Python-style negative indices */
+                    if(i < 0) i += std::ptrdiff_t(size[dimension]);
+                    if(i < 0 || std::size_t(i) >= size[dimension]) {
+                        PyErr_SetNone(PyExc_IndexError);
+                        throw py::error_already_set{};
+                    }
+                    data += i*stride[dimension];
+                    ++dimension;
+
+                } else {
+                    PyErr_Format(PyExc_TypeError, "expected an integer, slice or ellipsis but got %s", Py_TYPE(index.ptr())->tp_name);
+                    throw py::error_already_set{};
+                }
+            }
+            takeWhole(dimensions - dimension);
+
+            py::object owner = empty ? py::none{} : pyObjectHolderFor<Containers::PyArrayViewHolder>(self).owner;
+            switch(outDimensions) {
+                case 0: return py::cast(*reinterpret_cast<T*>(data));
+                case 1: return pyStridedArrayView<1>(reinterpret_cast<T*>(data), outSize, outStride, std::move(owner));
+                case 2: return pyStridedArrayView<2>(reinterpret_cast<T*>(data), outSize, outStride, std::move(owner));
+                case 3: return pyStridedArrayView<3>(reinterpret_cast<T*>(data), outSize, outStride, std::move(owner));
+                case 4: return pyStridedArrayView<4>(reinterpret_cast<T*>(data), outSize, outStride, std::move(owner));
+            }
+
+            CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+        }, "Index or slice the view")
+
+        /* Sub-view */
+        .def("sub", [](const Containers::StridedArrayView<dimensions, T>& self, const typename DimensionsTuple<dimensions, std::size_t>::Type& offset, const typename DimensionsTuple<dimensions, std::size_t>::Type& size) {
+            Containers::StridedDimensions<dimensions, std::size_t> begin;
+            Containers::StridedDimensions<dimensions, std::size_t> end;
+
+            bool empty = false;
+            for(std::size_t i = 0; i != dimensions; ++i) {
+                begin[i] = dimensionsTupleGet<std::size_t>(offset, i);
+                end[i] = begin[i] + dimensionsTupleGet<std::size_t>(size, i);
+                if(end[i] > self.size()[i]) {
+                    PyErr_Format(PyExc_IndexError, "sub-view [%zu:%zu] out of range for %zu elements in dimension %zu", begin[i], end[i], self.size()[i], i);
+                    throw py::error_already_set{};
+                }
+
+                if(begin[i] == end[i]) empty = true;
+            }
+
+            return Containers::pyArrayViewHolder(self.slice(begin, end), empty ? py::none{} : pyObjectHolderFor<Containers::PyArrayViewHolder>(self).owner);
+        }, "Sub-view of given offset and size", py::arg("offset"), py::arg("size"));
 }
 
 template<class T> void stridedArrayView2D(py::class_<Containers::StridedArrayView<2, T>, Containers::PyArrayViewHolder<Containers::StridedArrayView<2, T>>>& c) {
@@ -629,11 +1050,253 @@ template<class T> void mutableStridedArrayView4D(py::class_<Containers::StridedA
         }, "Set a value at given position");
 }
 
+template<unsigned dimensions, class T> void mutableStridedArrayView(py::class_<Containers::StridedArrayView<dimensions, T>, Containers::PyArrayViewHolder<Containers::StridedArrayView<dimensions, T>>>& c) {
+    c
+        /* Bulk operations */
+        .def("fill", [](const Containers::StridedArrayView<dimensions, T>& self, const T& value) {
+            releaseGilIfLarge(byteSize(self), viewOwnerOf(self), {}, [&]() {
+                fillInto(self, value);
+            });
+        }, "Fill the view with given value", py::arg("value"))
+        .def("copy_from", [](const Containers::StridedArrayView<dimensions, T>& self, const Containers::StridedArrayView<dimensions, const T>& other) {
+            checkSameSize(self, other);
+            releaseGilIfLarge(byteSize(self), viewOwnerOf(self), viewOwnerOf(other), [&]() {
+                /* If both are contiguous, it's a single copy. The views can
+                   overlap. */
+                if(isContiguous(self) && isContiguous(other))
+                    std::memmove(self.data(), other.data(), byteSize(self));
+                else copyIntoOverlapping(other, self);
+            });
+        }, "Copy contents of another view", py::arg("other"));
+}
+
+/* Conversion to a view of a different type, for each destination type */
+template<class U, unsigned dimensions, class T> void stridedArrayViewCastInto(py::class_<Containers::StridedArrayView<dimensions, T>, Containers::PyArrayViewHolder<Containers::StridedArrayView<dimensions, T>>>& c) {
+    c
+        .def("cast_into", [](const Containers::StridedArrayView<dimensions, T>& self, const Containers::StridedArrayView<dimensions, U>& other) {
+            checkSameSize(self, other);
+            releaseGilIfLarge(byteSize(self), viewOwnerOf(self), viewOwnerOf(other), [&]() {
+                copyIntoOverlapping(self, other);
+            });
+        }, "Convert contents to a view of a different type", py::arg("other"));
+}
+
+template<unsigned dimensions, class T> void stridedArrayViewCastInto(py::class_<Containers::StridedArrayView<dimensions, T>, Containers::PyArrayViewHolder<Containers::StridedArrayView<dimensions, T>>>& c) {
+    stridedArrayViewCastInto<std::uint16_t>(c);
+    stridedArrayViewCastInto<std::int32_t>(c);
+    stridedArrayViewCastInto<std::uint32_t>(c);
+    stridedArrayViewCastInto<float>(c);
+    stridedArrayViewCastInto<double>(c);
+}
+
+/* Buffers adopted by Array.adopt(). The Array deleter is a plain function
+   pointer that can't carry any state, so the buffer is looked up by its data
+   pointer instead and released once the array is destroyed. */
+std::unordered_multimap<const char*, Py_buffer>& adoptedBuffers() {
+    static std::unordered_multimap<const char*, Py_buffer> buffers;
+    return buffers;
+}
+
+void adoptedBufferDeleter(char* data, std::size_t) {
+    /* The array could have been moved to C++ and destroyed from there, so
+       ensure we have the GIL */
+    py::gil_scoped_acquire acquire;
+
+    auto found = adoptedBuffers().find(data);
+    CORRADE_INTERNAL_ASSERT(found != adoptedBuffers().end());
+    PyBuffer_Release(&found->second);
+    adoptedBuffers().erase(found);
+}
+
+bool arrayBufferProtocol(Containers::Array<char>& self, Py_buffer& buffer, int flags) {
+    buffer.ndim = 1;
+    buffer.itemsize = 1;
+    buffer.len = self.size();
+    buffer.buf = self.data();
+    buffer.readonly = false;
+    if((flags & PyBUF_FORMAT) == PyBUF_FORMAT)
+        buffer.format = const_cast<char*>(FormatStrings[formatIndex<char>()]);
+    if(flags != PyBUF_SIMPLE) {
+        /* The item size is 1, so the length is the same as the size. Pointing
+           to it directly as there's no other place to store the size
+           without leaking it. */
+        buffer.shape = &buffer.len;
+        if((flags & PyBUF_STRIDES) == PyBUF_STRIDES)
+            buffer.strides = &buffer.itemsize;
+    }
+
+    ++pyObjectHolderFor<Containers::PyArrayHolder>(self).exportCount;
+    return true;
+}
+
+void arrayBufferRelease(Containers::Array<char>& self, Py_buffer&) {
+    --pyObjectHolderFor<Containers::PyArrayHolder>(self).exportCount;
+}
+
+void array(py::class_<Containers::Array<char>, Containers::PyArrayHolder<Containers::Array<char>>>& c) {
+    c
+        /* Constructors */
+        .def(py::init(), "Default constructor")
+        .def(py::init([](std::size_t size) {
+            return Containers::Array<char>{Containers::ValueInit, size};
+        }), "Construct a zero-initialized array", py::arg("size"))
+        .def(py::init([](py::buffer other) {
+            /* GCC 4.8 otherwise loudly complains about missing initializers */
+            Py_buffer buffer{nullptr, nullptr, 0, 0, 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr};
+            if(PyObject_GetBuffer(other.ptr(), &buffer, PyBUF_SIMPLE) != 0)
+                throw py::error_already_set{};
+
+            Containers::ScopeGuard e{&buffer, PyBuffer_Release};
+
+            Containers::Array<char> out{Containers::NoInit, std::size_t(buffer.len)};
+            std::memcpy(out.data(), buffer.buf, buffer.len);
+            return out;
+        }), "Construct a copy of a buffer")
+        .def_static("adopt", [](py::buffer other) {
+            /* GCC 4.8 otherwise loudly complains about missing initializers */
+            Py_buffer buffer{nullptr, nullptr, 0, 0, 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr};
+            if(PyObject_GetBuffer(other.ptr(), &buffer, PyBUF_WRITABLE) != 0)
+                throw py::error_already_set{};
+
+            /* Nothing to adopt, release the buffer right away */
+            if(!buffer.len) {
+                PyBuffer_Release(&buffer);
+                return Containers::Array<char>{};
+            }
+
+            /* The buffer stays acquired until the array gets destroyed, which
+               keeps the owner alive and prevents it from being resized */
+            char* data = static_cast<char*>(buffer.buf);
+            const std::size_t size = buffer.len;
+            adoptedBuffers().emplace(data, buffer);
+            return Containers::Array<char>{data, size, adoptedBufferDeleter};
+        }, "Adopt a buffer without copying", py::arg("buffer"))
+
+        /* Length */
+        .def("__len__", &Containers::Array<char>::size, "Array size")
+
+        /* Conversion to bytes */
+        .def("__bytes__", [](const Containers::Array<char>& self) {
+            return py::bytes(self.data(), self.size());
+        }, "Convert to bytes")
+
+        /* Single item retrieval and modification. Need to raise IndexError in
+           order to allow iteration: https://docs.python.org/3/reference/datamodel.html#object.__getitem__ */
+        .def("__getitem__", [](const Containers::Array<char>& self, std::size_t i) {
+            if(i >= self.size()) {
+                PyErr_SetNone(PyExc_IndexError);
+                throw py::error_already_set{};
+            }
+            return self[i];
+        }, "Value at given position")
+        .def("__setitem__", [](Containers::Array<char>& self, std::size_t i, const char& value) {
+            if(i >= self.size()) {
+                PyErr_SetNone(PyExc_IndexError);
+                throw py::error_already_set{};
+            }
+            self[i] = value;
+        }, "Set a value at given position")
+
+        /* Slicing, returns a view referencing the array through a
+           memoryview */
+        .def("__getitem__", [](Containers::Array<char>& self, py::slice slice) -> py::object {
+            const Slice calculated = calculateSlice(slice, self.size());
+
+            /* Non-trivial stride, return a different type */
+            if(calculated.step != 1) {
+                auto sliced = Containers::stridedArrayView(Containers::arrayView(self)).slice(calculated.start, calculated.stop).every(calculated.step);
+                return pyCastButNotShitty(Containers::pyArrayViewHolder(sliced, sliced.size() ? viewOwner(pyObjectFromInstance(self).ptr()) : py::none{}));
+            }
+
+            /* Usual business */
+            auto sliced = Containers::arrayView(self).slice(calculated.start, calculated.stop);
+            return pyCastButNotShitty(Containers::pyArrayViewHolder(sliced, sliced.size() ? viewOwner(pyObjectFromInstance(self).ptr()) : py::none{}));
+        }, "Slice the array");
+
+    enableBetterBufferProtocol<Containers::Array<char>, arrayBufferProtocol, arrayBufferRelease>(c);
+}
+
+/* Views on concrete types other than bytes. Class names are suffixed the same
+   way as math types, e.g. ArrayViewf or MutableStridedArrayView2Dui. Vectors
+   and matrices are exposed as views with one or two extra dimensions, which is
+   also what numpy wants. */
+template<class T> void typedArrayViews(py::module& m, const std::string& suffix, const std::string& type) {
+    py::class_<Containers::ArrayView<const T>, Containers::PyArrayViewHolder<Containers::ArrayView<const T>>> arrayView_{m,
+        ("ArrayView" + suffix).data(), ("Array view on " + type + " values").data(), py::buffer_protocol{}};
+    arrayView(arrayView_);
+
+    py::class_<Containers::ArrayView<T>, Containers::PyArrayViewHolder<Containers::ArrayView<T>>> mutableArrayView_{m,
+        ("MutableArrayView" + suffix).data(), ("Mutable array view on " + type + " values").data(), py::buffer_protocol{}};
+    arrayView(mutableArrayView_);
+    mutableArrayView(mutableArrayView_);
+
+    py::class_<Containers::StridedArrayView<1, const T>, Containers::PyArrayViewHolder<Containers::StridedArrayView<1, const T>>> stridedArrayView1D_{m,
+        ("StridedArrayView1D" + suffix).data(), ("One-dimensional array view on " + type + " values with stride information").data(), py::buffer_protocol{}};
+    py::class_<Containers::StridedArrayView<2, const T>, Containers::PyArrayViewHolder<Containers::StridedArrayView<2, const T>>> stridedArrayView2D_{m,
+        ("StridedArrayView2D" + suffix).data(), ("Two-dimensional array view on " + type + " values with stride information").data(), py::buffer_protocol{}};
+    py::class_<Containers::StridedArrayView<3, const T>, Containers::PyArrayViewHolder<Containers::StridedArrayView<3, const T>>> stridedArrayView3D_{m,
+        ("StridedArrayView3D" + suffix).data(), ("Three-dimensional array view on " + type + " values with stride information").data(), py::buffer_protocol{}};
+    py::class_<Containers::StridedArrayView<4, const T>, Containers::PyArrayViewHolder<Containers::StridedArrayView<4, const T>>> stridedArrayView4D_{m,
+        ("StridedArrayView4D" + suffix).data(), ("Four-dimensional array view on " + type + " values with stride information").data(), py::buffer_protocol{}};
+    stridedArrayView(stridedArrayView1D_);
+    stridedArrayView1D(stridedArrayView1D_);
+    stridedArrayView(stridedArrayView2D_);
+    stridedArrayView2D(stridedArrayView2D_);
+    stridedArrayViewND(stridedArrayView2D_);
+    stridedArrayView(stridedArrayView3D_);
+    stridedArrayView3D(stridedArrayView3D_);
+    stridedArrayViewND(stridedArrayView3D_);
+    stridedArrayView(stridedArrayView4D_);
+    stridedArrayView4D(stridedArrayView4D_);
+    stridedArrayViewND(stridedArrayView4D_);
+
+    py::class_<Containers::StridedArrayView<1, T>, Containers::PyArrayViewHolder<Containers::StridedArrayView<1, T>>> mutableStridedArrayView1D_{m,
+        ("MutableStridedArrayView1D" + suffix).data(), ("Mutable one-dimensional array view on " + type + " values with stride information").data(), py::buffer_protocol{}};
+    py::class_<Containers::StridedArrayView<2, T>, Containers::PyArrayViewHolder<Containers::StridedArrayView<2, T>>> mutableStridedArrayView2D_{m,
+        ("MutableStridedArrayView2D" + suffix).data(), ("Mutable two-dimensional array view on " + type + " values with stride information").data(), py::buffer_protocol{}};
+    py::class_<Containers::StridedArrayView<3, T>, Containers::PyArrayViewHolder<Containers::StridedArrayView<3, T>>> mutableStridedArrayView3D_{m,
+        ("MutableStridedArrayView3D" + suffix).data(), ("Mutable three-dimensional array view on " + type + " values with stride information").data(), py::buffer_protocol{}};
+    py::class_<Containers::StridedArrayView<4, T>, Containers::PyArrayViewHolder<Containers::StridedArrayView<4, T>>> mutableStridedArrayView4D_{m,
+        ("MutableStridedArrayView4D" + suffix).data(), ("Mutable four-dimensional array view on " + type + " values with stride information").data(), py::buffer_protocol{}};
+    stridedArrayView(mutableStridedArrayView1D_);
+    stridedArrayView1D(mutableStridedArrayView1D_);
+    stridedArrayView(mutableStridedArrayView2D_);
+    stridedArrayView2D(mutableStridedArrayView2D_);
+    stridedArrayViewND(mutableStridedArrayView2D_);
+    stridedArrayView(mutableStridedArrayView3D_);
+    stridedArrayView3D(mutableStridedArrayView3D_);
+    stridedArrayViewND(mutableStridedArrayView3D_);
+    stridedArrayView(mutableStridedArrayView4D_);
+    stridedArrayView4D(mutableStridedArrayView4D_);
+    stridedArrayViewND(mutableStridedArrayView4D_);
+    mutableStridedArrayView(mutableStridedArrayView1D_);
+    mutableStridedArrayView1D(mutableStridedArrayView1D_);
+    mutableStridedArrayView(mutableStridedArrayView2D_);
+    mutableStridedArrayView2D(mutableStridedArrayView2D_);
+    mutableStridedArrayView(mutableStridedArrayView3D_);
+    mutableStridedArrayView3D(mutableStridedArrayView3D_);
+    mutableStridedArrayView(mutableStridedArrayView4D_);
+    mutableStridedArrayView4D(mutableStridedArrayView4D_);
+
+    /* Conversion between types, from both immutable and mutable views */
+    stridedArrayViewCastInto(stridedArrayView1D_);
+    stridedArrayViewCastInto(stridedArrayView2D_);
+    stridedArrayViewCastInto(stridedArrayView3D_);
+    stridedArrayViewCastInto(stridedArrayView4D_);
+    stridedArrayViewCastInto(mutableStridedArrayView1D_);
+    stridedArrayViewCastInto(mutableStridedArrayView2D_);
+    stridedArrayViewCastInto(mutableStridedArrayView3D_);
+    stridedArrayViewCastInto(mutableStridedArrayView4D_);
+}
+
 }
 
 void containers(py::module& m) {
     m.doc() = "Container implementations";
 
+    py::class_<Containers::Array<char>, Containers::PyArrayHolder<Containers::Array<char>>> array_{m,
+        "Array", "Owning array", py::buffer_protocol{}};
+
     py::class_<Containers::ArrayView<const char>, Containers::PyArrayViewHolder<Containers::ArrayView<const char>>> arrayView_{m,
         "ArrayView", "Array view", py::buffer_protocol{}};
     arrayView(arrayView_);
@@ -654,14 +1317,14 @@ void containers(py::module& m) {
     stridedArrayView(stridedArrayView1D_);
     stridedArrayView1D(stridedArrayView1D_);
     stridedArrayView(stridedArrayView2D_);
-    stridedArrayViewND(stridedArrayView2D_);
     stridedArrayView2D(stridedArrayView2D_);
+    stridedArrayViewND(stridedArrayView2D_);
     stridedArrayView(stridedArrayView3D_);
-    stridedArrayViewND(stridedArrayView3D_);
     stridedArrayView3D(stridedArrayView3D_);
+    stridedArrayViewND(stridedArrayView3D_);
     stridedArrayView(stridedArrayView4D_);
-    stridedArrayViewND(stridedArrayView4D_);
     stridedArrayView4D(stridedArrayView4D_);
+    stridedArrayViewND(stridedArrayView4D_);
 
     py::class_<Containers::StridedArrayView<1, char>, Containers::PyArrayViewHolder<Containers::StridedArrayView<1, char>>> mutableStridedArrayView1D_{m,
         "MutableStridedArrayView1D", "Mutable one-dimensional array view with stride information", py::buffer_protocol{}};
@@ -674,18 +1337,32 @@ void containers(py::module& m) {
     stridedArrayView(mutableStridedArrayView1D_);
     stridedArrayView1D(mutableStridedArrayView1D_);
     stridedArrayView(mutableStridedArrayView2D_);
-    stridedArrayViewND(mutableStridedArrayView2D_);
     stridedArrayView2D(mutableStridedArrayView2D_);
+    stridedArrayViewND(mutableStridedArrayView2D_);
     stridedArrayView(mutableStridedArrayView3D_);
-    stridedArrayViewND(mutableStridedArrayView3D_);
     stridedArrayView3D(mutableStridedArrayView3D_);
+    stridedArrayViewND(mutableStridedArrayView3D_);
     stridedArrayView(mutableStridedArrayView4D_);
-    stridedArrayViewND(mutableStridedArrayView4D_);
     stridedArrayView4D(mutableStridedArrayView4D_);
+    stridedArrayViewND(mutableStridedArrayView4D_);
+    mutableStridedArrayView(mutableStridedArrayView1D_);
     mutableStridedArrayView1D(mutableStridedArrayView1D_);
+    mutableStridedArrayView(mutableStridedArrayView2D_);
     mutableStridedArrayView2D(mutableStridedArrayView2D_);
+    mutableStridedArrayView(mutableStridedArrayView3D_);
     mutableStridedArrayView3D(mutableStridedArrayView3D_);
+    mutableStridedArrayView(mutableStridedArrayView4D_);
     mutableStridedArrayView4D(mutableStridedArrayView4D_);
+
+    /* Has to be done only after the views are registered so slicing can
+       return them */
+    array(array_);
+
+    typedArrayViews<std::uint16_t>(m, "us", "16-bit unsigned integer");
+    typedArrayViews<std::int32_t>(m, "i", "32-bit signed integer");
+    typedArrayViews<std::uint32_t>(m, "ui", "32-bit unsigned integer");
+    typedArrayViews<float>(m, "f", "float");
+    typedArrayViews<double>(m, "d", "double");
 }
 
 }
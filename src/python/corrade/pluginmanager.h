@@ -26,6 +26,8 @@
 */
 
 #include <memory> /* :( */
+#include <mutex>
+#include <vector>
 #include <pybind11/pybind11.h>
 #include <Corrade/PluginManager/Manager.h>
 
@@ -35,6 +37,46 @@
 
 namespace Corrade { namespace PluginManager {
 
+/* Bounded pool of idle plugin instances. Shared between the Python pool
+   object and all instances it handed out, the instances give themselves back
+   on destruction. Access to the idle list is guarded by a mutex, everything
+   else happens with the GIL held. */
+template<class T> struct PyPluginPool {
+    explicit PyPluginPool(pybind11::object manager, std::string plugin, std::size_t maxSize, void(*reset)(T&)) noexcept: manager{std::move(manager)}, plugin{std::move(plugin)}, maxSize{maxSize}, reset{reset} {}
+
+    ~PyPluginPool() {
+        /* The idle instances need to be destroyed before the manager */
+        idle.clear();
+    }
+
+    std::unique_ptr<T> acquire() {
+        std::lock_guard<std::mutex> lock{mutex};
+        if(idle.empty()) return nullptr;
+        std::unique_ptr<T> out = std::move(idle.back());
+        idle.pop_back();
+        return out;
+    }
+
+    void release(std::unique_ptr<T> instance) {
+        if(reset) reset(*instance);
+        std::lock_guard<std::mutex> lock{mutex};
+        /* If the pool is full, the instance gets destroyed */
+        if(idle.size() < maxSize) idle.push_back(std::move(instance));
+    }
+
+    std::size_t idleCount() {
+        std::lock_guard<std::mutex> lock{mutex};
+        return idle.size();
+    }
+
+    pybind11::object manager;
+    std::string plugin;
+    std::size_t maxSize;
+    void(*reset)(T&);
+    std::mutex mutex;
+    std::vector<std::unique_ptr<T>> idle;
+};
+
 /* Stores additional stuff needed for proper refcounting of array views. Due
    to obvious reasons we can't subclass plugins so this is the only possible
    way. */
@@ -52,6 +94,10 @@ template<class T> struct PyPluginHolder: std::unique_ptr<T> {
     PyPluginHolder<T>& operator=(const PyPluginHolder<T>&) = default;
 
     ~PyPluginHolder() {
+        /* Instances coming from a pool are given back to it */
+        if(pool && std::unique_ptr<T>::get())
+            pool->release(std::unique_ptr<T>{std::unique_ptr<T>::release()});
+
         /* On destruction, first `manager` and then the plugin would be
            destroyed, which would mean it asserts due to the manager being
            destructed while plugins are still around. To flip the order, we
@@ -60,6 +106,19 @@ template<class T> struct PyPluginHolder: std::unique_ptr<T> {
     }
 
     pybind11::object manager;
+
+    /* Memory the plugin may reference while it's in use, such as a
+       memory-mapped file opened by an importer. Destroyed only after the
+       plugin itself, thanks to the reset() in the destructor above. */
+    pybind11::object data;
+
+    /* Pool the instance came from, if any */
+    std::shared_ptr<PyPluginPool<T>> pool;
+
+    /* Set while the instance is used exclusively from elsewhere, such as
+       from a worker thread of an importer iterator. Accessed only with the
+       GIL held. */
+    bool busy{};
 };
 
 }}
@@ -104,6 +163,47 @@ template<class T> void manager(py::class_<PluginManager::Manager<T>, PluginManag
         });
 }
 
+template<class T> void managerPool(py::class_<PluginManager::Manager<T>, PluginManager::AbstractManager>& manager, py::class_<PluginManager::PyPluginPool<T>, std::shared_ptr<PluginManager::PyPluginPool<T>>>& c, void(*reset)(T&)) {
+    manager
+        /* The reset function is different for every plugin interface, so
+           it's captured in the lambda */
+        .def("pool", [reset](PluginManager::Manager<T>& self, const std::string& plugin, std::size_t maxSize) {
+            if(!(self.load(plugin) & PluginManager::LoadState::Loaded)) {
+                PyErr_Format(PyExc_RuntimeError, "can't load plugin %s", plugin.data());
+                throw py::error_already_set{};
+            }
+
+            return std::make_shared<PluginManager::PyPluginPool<T>>(py::cast(self), plugin, maxSize, reset);
+        }, "Create a pool of plugin instances", py::arg("plugin"), py::arg("max_size") = 4);
+
+    c
+        .def_property_readonly("manager", [](PluginManager::PyPluginPool<T>& self) {
+            return self.manager;
+        }, "Manager owning the pooled plugin instances")
+        .def_property_readonly("plugin", [](PluginManager::PyPluginPool<T>& self) {
+            return self.plugin;
+        }, "Pooled plugin name")
+        .def_property_readonly("max_size", [](PluginManager::PyPluginPool<T>& self) {
+            return self.maxSize;
+        }, "Max count of idle instances kept in the pool")
+        .def("__len__", &PluginManager::PyPluginPool<T>::idleCount, "Count of idle instances in the pool")
+        .def("instantiate", [](const std::shared_ptr<PluginManager::PyPluginPool<T>>& self) {
+            std::unique_ptr<T> instance = self->acquire();
+            if(!instance) {
+                auto loaded = py::cast<PluginManager::Manager<T>&>(self->manager).instantiate(self->plugin);
+                if(!loaded) {
+                    PyErr_Format(PyExc_RuntimeError, "can't instantiate plugin %s", self->plugin.data());
+                    throw py::error_already_set{};
+                }
+                instance.reset(loaded.release());
+            }
+
+            PluginManager::PyPluginHolder<T> holder{instance.release(), self->manager};
+            holder.pool = self;
+            return holder;
+        }, "Reuse an idle plugin instance or instantiate a new one");
+}
+
 }
 
 #endif
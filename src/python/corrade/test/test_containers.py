@@ -24,11 +24,102 @@
 #
 
 import array
+import io
 import sys
 import unittest
+import zlib
 
 from corrade import containers
 
+class Array(unittest.TestCase):
+    def test_init(self):
+        a = containers.Array()
+        self.assertEqual(len(a), 0)
+        self.assertEqual(bytes(a), b'')
+
+    def test_init_size(self):
+        a = containers.Array(5)
+        self.assertEqual(len(a), 5)
+        self.assertEqual(bytes(a), b'\x00\x00\x00\x00\x00')
+
+        a[1] = 'h'
+        self.assertEqual(a[1], 'h')
+        with self.assertRaises(IndexError):
+            a[5] = 'a'
+
+    def test_init_buffer(self):
+        a = bytearray(b'hello')
+        b = containers.Array(a)
+        self.assertEqual(len(b), 5)
+        self.assertEqual(bytes(b), b'hello')
+
+        # It's a copy
+        a[0] = ord('j')
+        self.assertEqual(bytes(b), b'hello')
+
+    def test_adopt(self):
+        a = bytearray(b'hello')
+        a_refcount = sys.getrefcount(a)
+
+        b = containers.Array.adopt(a)
+        self.assertEqual(len(b), 5)
+        self.assertEqual(bytes(b), b'hello')
+        self.assertEqual(sys.getrefcount(a), a_refcount + 1)
+
+        # It's not a copy
+        a[0] = ord('j')
+        self.assertEqual(bytes(b), b'jello')
+
+        # The buffer is kept acquired, so the owner can't be resized
+        with self.assertRaises(BufferError):
+            a.append(ord('!'))
+
+        del b
+        self.assertEqual(sys.getrefcount(a), a_refcount)
+        a.append(ord('!'))
+        self.assertEqual(a, b'jello!')
+
+    def test_adopt_immutable(self):
+        with self.assertRaisesRegex(BufferError, "Object is not writable."):
+            containers.Array.adopt(b'hello')
+
+    def test_slice(self):
+        a = containers.Array(b'hello')
+        a_refcount = sys.getrefcount(a)
+
+        b = a[1:4]
+        self.assertIsInstance(b, containers.MutableArrayView)
+        self.assertIsInstance(b.owner, memoryview)
+        self.assertIs(b.owner.obj, a)
+        self.assertEqual(bytes(b), b'ell')
+        self.assertEqual(sys.getrefcount(a), a_refcount + 1)
+
+        b[0] = 'a'
+        self.assertEqual(bytes(a), b'hallo')
+
+        c = a[::2]
+        self.assertIsInstance(c, containers.MutableStridedArrayView1D)
+        self.assertEqual(bytes(c), b'hlo')
+
+    def test_convert_memoryview(self):
+        a = containers.Array(b'hello')
+        a_refcount = sys.getrefcount(a)
+
+        b = memoryview(a)
+        self.assertEqual(b.ndim, 1)
+        self.assertEqual(b.shape, (5,))
+        self.assertEqual(bytes(b), b'hello')
+        self.assertIs(b.obj, a)
+        self.assertEqual(sys.getrefcount(a), a_refcount + 1)
+
+        b[0] = ord('j')
+        self.assertEqual(bytes(a), b'jello')
+
+        # Views created from the array don't copy
+        c = containers.ArrayView(a)
+        self.assertIs(c.owner.obj, a)
+        self.assertEqual(bytes(c), b'jello')
+
 class ArrayView(unittest.TestCase):
     def test_init(self):
         a = containers.ArrayView()
@@ -227,6 +318,24 @@ class ArrayView(unittest.TestCase):
         with self.assertRaisesRegex(TypeError, "cannot modify read-only memory"):
             c[-1] = ord('?')
 
+    def test_fill(self):
+        a = bytearray(b'World is hell!')
+        containers.MutableArrayView(a)[9:13].fill('*')
+        self.assertEqual(a, b'World is ****!')
+
+    def test_copy_from(self):
+        a = bytearray(b'World is hell!')
+        b = containers.MutableArrayView(a)
+        b[9:13].copy_from(b'nice')
+        self.assertEqual(a, b'World is nice!')
+
+        # Overlapping
+        b[1:].copy_from(b[:-1])
+        self.assertEqual(a, b'WWorld is nice')
+
+        with self.assertRaisesRegex(ValueError, "expected a view of 4 items but got 3"):
+            b[9:13].copy_from(b'bad')
+
     def test_convert_mutable_memoryview(self):
         a = bytearray(b'World is hell!')
         b = memoryview(containers.MutableArrayView(a))
@@ -364,6 +473,21 @@ class StridedArrayView1D(unittest.TestCase):
         with self.assertRaisesRegex(TypeError, "indices must be integers"):
             containers.StridedArrayView1D()[-5:3:"boo"]
 
+    def test_sub(self):
+        a = b'World is hell!'
+        b = containers.StridedArrayView1D(a)[::2].sub(2, 3)
+        self.assertEqual(b.size, (3,))
+        self.assertEqual(b.stride, (2,))
+        self.assertIs(b.owner, a)
+        self.assertEqual(bytes(b), b'rdi')
+
+        c = containers.StridedArrayView1D(a).sub(14, 0)
+        self.assertEqual(c.size, (0,))
+        self.assertIs(c.owner, None)
+
+        with self.assertRaisesRegex(IndexError, "sub-view \\[12:15\\] out of range for 14 elements"):
+            containers.StridedArrayView1D(a).sub(12, 3)
+
     def test_slice_stride(self):
         a = b'World_ _i_s_ _hell!'
         b = containers.StridedArrayView1D(a)
@@ -678,6 +802,61 @@ class StridedArrayView2D(unittest.TestCase):
         self.assertEqual(d.stride, (8, 0))
         self.assertEqual(bytes(d), b'3377bb')
 
+    def test_bytes(self):
+        a = (b'01234567'
+             b'456789ab'
+             b'89abcdef')
+        v = memoryview(a).cast('b', shape=[3, 8])
+
+        # Contiguous, copied at once
+        b = containers.StridedArrayView2D(v)
+        self.assertEqual(bytes(b), a)
+
+        # Rows contiguous, copied row by row
+        c = containers.StridedArrayView2D(v)[::-2, 2:6]
+        self.assertEqual(c.stride, (-16, 1))
+        self.assertEqual(bytes(c), b'abcd2345')
+
+        # Contiguous with one row, the outer stride doesn't matter
+        d = containers.StridedArrayView2D(v)[1:2]
+        self.assertEqual(bytes(d), b'456789ab')
+
+        # Empty
+        e = containers.StridedArrayView2D(v)[1:1]
+        self.assertEqual(bytes(e), b'')
+
+    def test_convert_simple_buffer(self):
+        a = (b'01234567'
+             b'456789ab'
+             b'89abcdef')
+        v = memoryview(a).cast('b', shape=[3, 8])
+
+        # Contiguous views can be consumed by APIs accepting only simple
+        # buffers
+        b = containers.StridedArrayView2D(v)
+        self.assertEqual(zlib.crc32(b), zlib.crc32(a))
+        self.assertEqual(zlib.crc32(b[1:]), zlib.crc32(a[8:]))
+        self.assertEqual(zlib.crc32(b[:, 3:4][1:2]), zlib.crc32(b'7'))
+
+        with self.assertRaisesRegex(BufferError, "array view is not contiguous"):
+            zlib.crc32(b[:, 1:3])
+        with self.assertRaisesRegex(BufferError, "array view is not contiguous"):
+            zlib.crc32(b.flipped(0))
+
+    def test_convert_simple_buffer_mutable(self):
+        a = bytearray(b'01234567'
+                      b'456789ab'
+                      b'89abcdef')
+        v = memoryview(a).cast('b', shape=[3, 8])
+
+        b = containers.MutableStridedArrayView2D(v)[1:2]
+        self.assertEqual(io.BytesIO(b'hello world!').readinto(b), 8)
+        self.assertEqual(a, b'01234567hello wo89abcdef')
+
+        # Immutable views can't be written to
+        with self.assertRaisesRegex(BufferError, "array view is not writable"):
+            io.BytesIO(b'hello').readinto(containers.StridedArrayView2D(v))
+
     def test_convert_memoryview(self):
         a = memoryview(b'01234567'
                        b'456789ab'
@@ -716,6 +895,88 @@ class StridedArrayView3D(unittest.TestCase):
         self.assertEqual(b[1, 2, 3], '7')
         self.assertEqual(b[1][2][3], '7')
 
+    def test_getitem_mixed(self):
+        a = (b'01234567'
+             b'456789ab'
+             b'89abcdef'
+
+             b'cdef0123'
+             b'01234567'
+             b'456789ab')
+        v = containers.StridedArrayView3D(memoryview(a).cast('b', shape=[2, 3, 8]))
+
+        b = v[1, ::2]
+        self.assertIsInstance(b, containers.StridedArrayView2D)
+        self.assertEqual(b.size, (2, 8))
+        self.assertEqual(b.stride, (16, 1))
+        self.assertIs(b.owner, a)
+        self.assertEqual(bytes(b), b'cdef0123456789ab')
+
+        c = v[:, -1, 6::-3]
+        self.assertIsInstance(c, containers.StridedArrayView2D)
+        self.assertEqual(c.size, (2, 3))
+        self.assertEqual(c.stride, (24, -3))
+        self.assertEqual(bytes(c), b'eb8a74')
+
+        d = v[..., 3]
+        self.assertIsInstance(d, containers.StridedArrayView2D)
+        self.assertEqual(d.size, (2, 3))
+        self.assertEqual(d.stride, (24, 8))
+        self.assertEqual(bytes(d), b'37bf37')
+
+        e = v[0, ..., 1:3]
+        self.assertIsInstance(e, containers.StridedArrayView2D)
+        self.assertEqual(bytes(e), b'12569a')
+
+        f = v[1, 2, -1]
+        self.assertEqual(f, 'b')
+
+        g = v[0, 1:1]
+        self.assertEqual(g.size, (0, 8))
+        self.assertIs(g.owner, None)
+
+        h = v[0, 1:3, ...]
+        self.assertIsInstance(h, containers.StridedArrayView2D)
+        self.assertEqual(bytes(h), b'456789ab89abcdef')
+
+    def test_getitem_mixed_invalid(self):
+        v = containers.StridedArrayView3D(memoryview(b'0123456789ab').cast('b', shape=[2, 3, 2]))
+
+        with self.assertRaisesRegex(IndexError, "too many indices for a 3-dimensional view"):
+            v[0, 0, 0, 0]
+        with self.assertRaisesRegex(IndexError, "an index can only have a single ellipsis"):
+            v[..., 0, ...]
+        with self.assertRaises(IndexError):
+            v[0, 3]
+        with self.assertRaises(IndexError):
+            v[0, -4]
+        with self.assertRaisesRegex(TypeError, "expected an integer, slice or ellipsis but got str"):
+            v[0, "boo"]
+
+    def test_sub(self):
+        a = (b'01234567'
+             b'456789ab'
+             b'89abcdef'
+
+             b'cdef0123'
+             b'01234567'
+             b'456789ab')
+        v = containers.StridedArrayView3D(memoryview(a).cast('b', shape=[2, 3, 8]))
+
+        b = v.sub((1, 1, 2), (1, 2, 3))
+        self.assertIsInstance(b, containers.StridedArrayView3D)
+        self.assertEqual(b.size, (1, 2, 3))
+        self.assertEqual(b.stride, (24, 8, 1))
+        self.assertIs(b.owner, a)
+        self.assertEqual(bytes(b), b'234678')
+
+        c = v.sub((0, 3, 0), (2, 0, 8))
+        self.assertEqual(c.size, (2, 0, 8))
+        self.assertIs(c.owner, None)
+
+        with self.assertRaisesRegex(IndexError, "sub-view \\[6:9\\] out of range for 8 elements in dimension 2"):
+            v.sub((0, 0, 6), (1, 1, 3))
+
     def test_init_buffer_mutable(self):
         a = bytearray(b'01234567'
                       b'456789ab'
@@ -852,3 +1113,114 @@ class StridedArrayView4D(unittest.TestCase):
         self.assertEqual(f.size, (2, 1, 3, 5))
         self.assertEqual(f.stride, (24, 24, 8, 0))
         self.assertEqual(bytes(f), b'000004444488888ccccc0000044444')
+
+class TypedArrayView(unittest.TestCase):
+    def test_init_buffer(self):
+        a = array.array('f', [1.0, 4.5, 7.75])
+        b = containers.ArrayViewf(a)
+        self.assertIs(b.owner, a)
+        self.assertEqual(len(b), 3)
+        self.assertEqual(b[1], 4.5)
+        self.assertEqual(bytes(b), a.tobytes())
+
+        c = containers.MutableArrayViewui(array.array('I', [3, 17, 22]))
+        c[2] = 5
+        self.assertEqual(len(c), 3)
+        self.assertEqual(c[2], 5)
+
+    def test_init_buffer_unexpected_format(self):
+        a = array.array('i', [1, 2, 3])
+        with self.assertRaisesRegex(BufferError, "expected format f but got i"):
+            b = containers.ArrayViewf(a)
+        with self.assertRaisesRegex(BufferError, "expected format d but got i"):
+            b = containers.StridedArrayView1Dd(a)
+
+    def test_convert_memoryview(self):
+        a = array.array('H', [1, 2, 3, 65535])
+        b = containers.ArrayViewus(a)
+        c = memoryview(b)
+        self.assertEqual(c.format, 'H')
+        self.assertEqual(c.itemsize, 2)
+        self.assertEqual(c.shape, (4,))
+        self.assertEqual(c.tolist(), [1, 2, 3, 65535])
+
+class TypedStridedArrayView(unittest.TestCase):
+    def test_init_buffer(self):
+        a = array.array('f', [1.0, 2.0, 3.0, 4.0, 5.0, 6.0])
+        b = containers.StridedArrayView2Df(memoryview(a).cast('B').cast('f', shape=[2, 3]))
+        self.assertEqual(b.size, (2, 3))
+        self.assertEqual(b.stride, (12, 4))
+        self.assertEqual(b[1, 2], 6.0)
+        self.assertEqual(b[1][0], 4.0)
+        self.assertEqual(bytes(b), a.tobytes())
+
+        # Every second "vector", only the first two components. Bytes should
+        # contain whole items.
+        c = b[::-1, :2]
+        self.assertEqual(c.size, (2, 2))
+        self.assertEqual(c.stride, (-12, 4))
+        self.assertEqual(bytes(c), array.array('f', [4.0, 5.0, 1.0, 2.0]).tobytes())
+
+    def test_init_buffer_mutable(self):
+        a = array.array('i', [1, 2, 3, 4, 5, 6])
+        b = containers.MutableStridedArrayView2Di(memoryview(a).cast('B').cast('i', shape=[3, 2]))
+        b[2, 1] = -7
+        b[0][1] = 15
+        self.assertEqual(a.tolist(), [1, 15, 3, 4, 5, -7])
+
+    def test_convert_memoryview(self):
+        a = array.array('d', [1.0, 2.0, 3.0, 4.0, 5.0, 6.0])
+        b = containers.StridedArrayView2Dd(memoryview(a).cast('B').cast('d', shape=[3, 2])).transposed(0, 1)
+        c = memoryview(b)
+        self.assertEqual(c.format, 'd')
+        self.assertEqual(c.itemsize, 8)
+        self.assertEqual(c.shape, (2, 3))
+        self.assertEqual(c.strides, (8, 16))
+        self.assertEqual(c.tolist(), [[1.0, 3.0, 5.0], [2.0, 4.0, 6.0]])
+
+    def test_fill(self):
+        a = array.array('f', [1.0, 2.0, 3.0, 4.0, 5.0, 6.0])
+        b = containers.MutableStridedArrayView2Df(memoryview(a).cast('B').cast('f', shape=[2, 3]))
+        b[:, 1:].fill(0.5)
+        self.assertEqual(a.tolist(), [1.0, 0.5, 0.5, 4.0, 0.5, 0.5])
+
+        # Contiguous
+        b.fill(-1.0)
+        self.assertEqual(a.tolist(), [-1.0]*6)
+
+    def test_copy_from(self):
+        a = array.array('i', [1, 2, 3, 4, 5, 6])
+        b = containers.MutableStridedArrayView2Di(memoryview(a).cast('B').cast('i', shape=[2, 3]))
+        c = containers.StridedArrayView2Di(memoryview(array.array('i', [7, 8, 9, 10, 11, 12])).cast('B').cast('i', shape=[3, 2]))
+
+        # Different strides on both sides
+        b[:, 1:].copy_from(c[1:].transposed(0, 1))
+        self.assertEqual(a.tolist(), [1, 9, 11, 4, 10, 12])
+
+        # Contiguous, directly from a buffer
+        b.copy_from(memoryview(array.array('i', [0, 1, 2, 3, 4, 5])).cast('B').cast('i', shape=[2, 3]))
+        self.assertEqual(a.tolist(), [0, 1, 2, 3, 4, 5])
+
+        # Overlapping and non-contiguous, a forward copy would repeat the
+        # first item everywhere
+        d = array.array('i', [0, 1, 2, 3, 4, 5, 6, 7])
+        e = containers.MutableStridedArrayView1Di(d)[::2]
+        e[1:].copy_from(e[:-1])
+        self.assertEqual(d.tolist(), [0, 1, 0, 3, 2, 5, 4, 7])
+
+        with self.assertRaisesRegex(ValueError, "expected a view of 3 items in dimension 1 but got 2"):
+            b.copy_from(c[:2])
+
+    def test_cast_into(self):
+        a = array.array('H', [1, 2, 3, 65535])
+        b = array.array('d', [0.0]*4)
+        containers.StridedArrayView1Dus(a).cast_into(containers.MutableStridedArrayView1Dd(b))
+        self.assertEqual(b.tolist(), [1.0, 2.0, 3.0, 65535.0])
+
+        # Strided, into a buffer directly
+        c = array.array('f', [0.0]*2)
+        containers.StridedArrayView1Dd(b)[::2].cast_into(c)
+        self.assertEqual(c.tolist(), [1.0, 3.0])
+
+        with self.assertRaisesRegex(ValueError, "expected a view of 4 items in dimension 0 but got 2"):
+            containers.StridedArrayView1Dus(a).cast_into(c)
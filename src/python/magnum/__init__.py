@@ -34,19 +34,67 @@ import sys
 sys.modules['magnum.math'] = math
 
 # In case Magnum is built statically, the whole core project is put into
-# _magnum. Then we need to do the same as above but for all modules.
-for i in ['gl', 'meshtools', 'platform', 'primitives', 'scenegraph', 'shaders', 'trade']:
-    if i in globals(): sys.modules['magnum.' + i] = globals()[i]
+# _magnum. The submodules are initialized only on first access to avoid
+# paying for all of them on `import magnum`, so register them in sys.modules
+# once they get loaded.
+import _magnum
 
-# Platform has subpackages
-if 'platform' in globals():
-    for i in ['glfw', 'sdl2', 'glx', 'wgl', 'egl']:
-        if hasattr(platform, i): sys.modules['magnum.platform.' + i] = getattr(platform, i)
+def _register(name, module):
+    globals()[name] = module
+    sys.modules['magnum.' + name] = module
 
-# Scenegraph has subpackages
-if 'scenegraph' in globals():
-    for i in ['matrix', 'trs']:
-        sys.modules['magnum.scenegraph.' + i] = getattr(scenegraph, i)
+    # Platform has subpackages
+    if name == 'platform':
+        for i in ['glfw', 'sdl2', 'glx', 'wgl', 'egl']:
+            if hasattr(module, i): sys.modules['magnum.platform.' + i] = getattr(module, i)
+
+    # Scenegraph has subpackages
+    if name == 'scenegraph':
+        for i in ['matrix', 'trs']:
+            sys.modules['magnum.scenegraph.' + i] = getattr(module, i)
+
+if hasattr(_magnum, '_load_submodule'):
+    import importlib.abc
+    import importlib.util
+
+    _submodules = ['gl', 'meshtools', 'platform', 'primitives', 'scenegraph', 'shaders', 'trade']
+
+    def _load(name):
+        module = _magnum._load_submodule(name)
+        if module is None: return None
+
+        # Dependencies such as gl for shaders got initialized as well,
+        # register them too
+        for i in _submodules:
+            if hasattr(_magnum, i) and 'magnum.' + i not in sys.modules:
+                _register(i, getattr(_magnum, i))
+        return module
+
+    # PEP 562, makes `magnum.gl` work without an explicit import
+    def __getattr__(name):
+        if name in _submodules:
+            module = _load(name)
+            if module is not None: return module
+        raise AttributeError("module 'magnum' has no attribute '{}'".format(name))
+
+    # Makes `import magnum.gl` and `from magnum import gl` work
+    class _SubmoduleFinder(importlib.abc.MetaPathFinder, importlib.abc.Loader):
+        def find_spec(self, fullname, path, target=None):
+            if not fullname.startswith('magnum.'): return None
+            name = fullname[len('magnum.'):].split('.')[0]
+            if name not in _submodules or _load(name) is None: return None
+            # Nested packages such as magnum.platform.glfw are registered
+            # by _load() already
+            if fullname in sys.modules: return importlib.util.spec_from_loader(fullname, self)
+            return None
+
+        def create_module(self, spec):
+            return sys.modules[spec.name]
+
+        def exec_module(self, module):
+            pass
+
+    sys.meta_path.insert(0, _SubmoduleFinder())
 
 __all__ = [
     'Deg', 'Rad',
@@ -57,6 +105,8 @@ __all__ = [
     'Vector2i', 'Vector3i', 'Vector4i',
     'Vector2ui', 'Vector3ui', 'Vector4ui',
     'Color3', 'Color4',
+    'Vector2Array', 'Vector3Array', 'Vector4Array',
+    'Vector2dArray', 'Vector3dArray', 'Vector4dArray',
 
     'Matrix2x2', 'Matrix2x3', 'Matrix2x4',
     'Matrix3x2', 'Matrix3x3', 'Matrix3x4',
@@ -53,6 +53,7 @@ template<class T> struct PyDimensionTraits<3, T> {
 void math(py::module& root, py::module& m);
 void mathVectorFloat(py::module& root, py::module& m);
 void mathVectorIntegral(py::module& root, py::module& m);
+void mathVectorArray(py::module& root, py::module& m);
 void mathMatrixFloat(py::module& root, PyTypeObject* metaclass);
 void mathMatrixDouble(py::module& root, PyTypeObject* metaclass);
 void mathRange(py::module& root, py::module& m);
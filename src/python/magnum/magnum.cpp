@@ -47,12 +47,32 @@ namespace py = pybind11;
 
 namespace magnum { namespace {
 
+/* Checked upfront so a too small array is reported as an exception instead
+   of hitting an assertion in the image constructor, and isn't moved from.
+   Counts the whole skip, so it's slightly stricter than the assertion. */
+template<UnsignedInt dimensions> void checkImageDataSize(const PixelStorage& storage, PixelFormat format, const VectorTypeFor<dimensions, Int>& size, const Containers::Array<char>& data) {
+    const std::pair<Math::Vector3<std::size_t>, Math::Vector3<std::size_t>> properties = storage.dataProperties(pixelSize(format), Vector3i::pad(size, 1));
+    const std::size_t expected = properties.first.sum() + properties.second.product();
+    if(data.size() < expected) {
+        PyErr_Format(PyExc_ValueError, "data too small, got %zu but expected at least %zu bytes", data.size(), expected);
+        throw py::error_already_set{};
+    }
+}
+
 template<class T> void image(py::class_<T>& c) {
     c
-        /* Constructors. Only the ones taking the generic format and *not*
-           taking an Array, as Python has no way to "move" it in */
+        /* Constructors. Only the ones taking the generic format. The array
+           is moved in from containers.Array, leaving it empty. */
         .def(py::init<const PixelStorage&, PixelFormat>(), "Construct an image placeholder")
         .def(py::init<PixelFormat>(), "Construct an image placeholder")
+        .def(py::init([](const PixelStorage& storage, PixelFormat format, const typename PyDimensionTraits<T::Dimensions, Int>::VectorType& size, Containers::Array<char>& data) {
+            checkImageDataSize<T::Dimensions>(storage, format, size, data);
+            return T{storage, format, size, Containers::pyArrayMove(data)};
+        }), "Construct an image", py::arg("storage"), py::arg("format"), py::arg("size"), py::arg("data"))
+        .def(py::init([](PixelFormat format, const typename PyDimensionTraits<T::Dimensions, Int>::VectorType& size, Containers::Array<char>& data) {
+            checkImageDataSize<T::Dimensions>(PixelStorage{}, format, size, data);
+            return T{format, size, Containers::pyArrayMove(data)};
+        }), "Construct an image", py::arg("format"), py::arg("size"), py::arg("data"))
 
         /* Properties */
         .def_property_readonly("storage", &T::storage, "Storage of pixel data")
@@ -328,82 +348,131 @@ void magnum(py::module& m) {
 
 }}
 
-/* TODO: remove declaration when https://github.com/pybind/pybind11/pull/1863
-   is released */
-extern "C" PYBIND11_EXPORT PyObject* PyInit__magnum();
-PYBIND11_MODULE(_magnum, m) {
-    m.doc() = "Root Magnum module";
-
-    /* We need ArrayView for images */
-    py::module::import("corrade.containers");
-
-    py::module math = m.def_submodule("math");
-    magnum::math(m, math);
-
-    /* These need stuff from math, so need to be called after */
-    magnum::magnum(m);
+#ifdef MAGNUM_BUILD_STATIC
+namespace magnum { namespace {
 
-    /* In case Magnum is a bunch of static libraries, put everything into a
-       single shared lib to make it easier to install (which is the point of
-       static builds) and avoid issues with multiply-defined global symbols.
+/* Initializes a submodule of the static build, together with all submodules
+   it depends on. Returns the existing submodule if already initialized and
+   None if there's no such submodule. */
+py::object loadSubmodule(py::module m, const std::string& name) {
+    if(py::hasattr(m, name.data())) return m.attr(name.data());
 
-       These need to be defined in the order they depend on. */
-    #ifdef MAGNUM_BUILD_STATIC
     #ifdef Magnum_GL_FOUND
-    py::module gl = m.def_submodule("gl");
-    magnum::gl(gl);
+    if(name == "gl") {
+        py::module gl = m.def_submodule("gl");
+        magnum::gl(gl);
+        return std::move(gl);
+    }
     #endif
 
     #ifdef Magnum_SceneGraph_FOUND
-    py::module scenegraph = m.def_submodule("scenegraph");
-    magnum::scenegraph(scenegraph);
+    if(name == "scenegraph") {
+        py::module scenegraph = m.def_submodule("scenegraph");
+        magnum::scenegraph(scenegraph);
+        return std::move(scenegraph);
+    }
     #endif
 
     #ifdef Magnum_Trade_FOUND
-    py::module trade = m.def_submodule("trade");
-    magnum::trade(trade);
+    if(name == "trade") {
+        py::module trade = m.def_submodule("trade");
+        magnum::trade(trade);
+        return std::move(trade);
+    }
     #endif
 
     #ifdef Magnum_MeshTools_FOUND
-    /* Depends on trade and gl */
-    py::module meshtools = m.def_submodule("meshtools");
-    magnum::meshtools(meshtools);
+    if(name == "meshtools") {
+        /* Depends on trade and gl */
+        loadSubmodule(m, "trade");
+        loadSubmodule(m, "gl");
+        py::module meshtools = m.def_submodule("meshtools");
+        magnum::meshtools(meshtools);
+        return std::move(meshtools);
+    }
     #endif
 
     #ifdef Magnum_Primitives_FOUND
-    /* Depends on trade */
-    py::module primitives = m.def_submodule("primitives");
-    magnum::primitives(primitives);
+    if(name == "primitives") {
+        /* Depends on trade */
+        loadSubmodule(m, "trade");
+        py::module primitives = m.def_submodule("primitives");
+        magnum::primitives(primitives);
+        return std::move(primitives);
+    }
     #endif
 
     #ifdef Magnum_Shaders_FOUND
-    /* Depends on gl */
-    py::module shaders = m.def_submodule("shaders");
-    magnum::shaders(shaders);
+    if(name == "shaders") {
+        /* Depends on gl */
+        loadSubmodule(m, "gl");
+        py::module shaders = m.def_submodule("shaders");
+        magnum::shaders(shaders);
+        return std::move(shaders);
+    }
     #endif
 
-    /* Keep the doc in sync with platform/__init__.py */
-    py::module platform = m.def_submodule("platform");
-    platform.doc() = "Platform-specific application and context creation";
+    if(name == "platform") {
+        /* The applications depend on gl */
+        loadSubmodule(m, "gl");
 
-    #ifdef Magnum_GlfwApplication_FOUND
-    py::module glfw = platform.def_submodule("glfw");
-    magnum::platform::glfw(glfw);
-    #endif
+        /* Keep the doc in sync with platform/__init__.py */
+        py::module platform = m.def_submodule("platform");
+        platform.doc() = "Platform-specific application and context creation";
 
-    #ifdef Magnum_Sdl2Application_FOUND
-    py::module sdl2 = platform.def_submodule("sdl2");
-    magnum::platform::sdl2(sdl2);
-    #endif
+        #ifdef Magnum_GlfwApplication_FOUND
+        py::module glfw = platform.def_submodule("glfw");
+        magnum::platform::glfw(glfw);
+        #endif
 
-    #ifdef Magnum_WindowlessEglApplication_FOUND
-    py::module egl = platform.def_submodule("egl");
-    magnum::platform::egl(egl);
-    #endif
+        #ifdef Magnum_Sdl2Application_FOUND
+        py::module sdl2 = platform.def_submodule("sdl2");
+        magnum::platform::sdl2(sdl2);
+        #endif
 
-    #ifdef Magnum_WindowlessGlxApplication_FOUND
-    py::module glx = platform.def_submodule("glx");
-    magnum::platform::glx(glx);
-    #endif
+        #ifdef Magnum_WindowlessEglApplication_FOUND
+        py::module egl = platform.def_submodule("egl");
+        magnum::platform::egl(egl);
+        #endif
+
+        #ifdef Magnum_WindowlessGlxApplication_FOUND
+        py::module glx = platform.def_submodule("glx");
+        magnum::platform::glx(glx);
+        #endif
+
+        return std::move(platform);
+    }
+
+    return py::none{};
+}
+
+}}
+#endif
+
+/* TODO: remove declaration when https://github.com/pybind/pybind11/pull/1863
+   is released */
+extern "C" PYBIND11_EXPORT PyObject* PyInit__magnum();
+PYBIND11_MODULE(_magnum, m) {
+    m.doc() = "Root Magnum module";
+
+    /* We need ArrayView for images */
+    py::module::import("corrade.containers");
+
+    py::module math = m.def_submodule("math");
+    magnum::math(m, math);
+
+    /* These need stuff from math, so need to be called after */
+    magnum::magnum(m);
+
+    /* In case Magnum is a bunch of static libraries, put everything into a
+       single shared lib to make it easier to install (which is the point of
+       static builds) and avoid issues with multiply-defined global symbols.
+       The submodules are initialized only when first accessed from
+       magnum/__init__.py, so processes that need just math or trade don't
+       pay for GL, shaders and platform bindings. */
+    #ifdef MAGNUM_BUILD_STATIC
+    m.def("_load_submodule", [](const std::string& name) {
+        return magnum::loadSubmodule(py::module::import("_magnum"), name);
+    }, "Initialize a submodule on first access");
     #endif
 }
@@ -26,14 +26,18 @@
 #include <sstream>
 #include <pybind11/pybind11.h>
 #include <pybind11/operators.h>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Magnum/Magnum.h>
 #include <Magnum/Math/Angle.h>
 #include <Magnum/Math/BoolVector.h>
 #include <Magnum/Math/Functions.h>
+#include <Magnum/Math/Matrix4.h>
 #include <Magnum/Math/Quaternion.h>
 
 #include "magnum/bootstrap.h"
 #include "magnum/math.h"
+#include "magnum/math.vectorarray.h"
 
 namespace magnum {
 
@@ -347,6 +351,145 @@ template<class T> void quaternion(py::module& m, py::class_<T>& c) {
         .def("__repr__", repr<T>, "Object representation");
 }
 
+/* Batch quaternion operations. Quaternions are passed as (n, 4) buffers in
+   the (x, y, z, w) order, which is also their memory layout, so the rows can
+   be accessed directly. */
+template<class T> void checkQuaternionRows(const PyRowBuffer<T>& buffer, const char* name, std::size_t size) {
+    if(buffer.rowSize() != 4 || buffer.size() != size) {
+        PyErr_Format(PyExc_ValueError, "expected %s to have shape (%zu, 4) but got (%zu, %zu)", name, size, buffer.size(), buffer.rowSize());
+        throw py::error_already_set{};
+    }
+}
+
+template<class T> py::object quaternionOutput(const py::object& out, std::size_t size) {
+    if(!out.is_none()) return out;
+    return py::cast(PyVectorArray<Math::Vector4<T>>{size});
+}
+
+template<class T, Math::Quaternion<T>(*interpolate)(const Math::Quaternion<T>&, const Math::Quaternion<T>&, T)> py::object interpolateBatch(const py::buffer& a, const py::buffer& b, const py::object& t, const py::object& out) {
+    const PyRowBuffer<T> bufferA{a, "a"};
+    checkQuaternionRows(bufferA, "a", bufferA.size());
+    const PyRowBuffer<T> bufferB{b, "b"};
+    checkQuaternionRows(bufferB, "b", bufferA.size());
+
+    /* The factor is either a scalar or one value per quaternion */
+    Containers::Pointer<PyRowBuffer<T>> bufferT;
+    T scalarT{};
+    if(PyObject_CheckBuffer(t.ptr())) {
+        bufferT = Containers::pointer<PyRowBuffer<T>>(t, "t");
+        if(bufferT->rowSize() != 1 || bufferT->size() != bufferA.size()) {
+            PyErr_Format(PyExc_ValueError, "expected t to have shape (%zu) but got (%zu, %zu)", bufferA.size(), bufferT->size(), bufferT->rowSize());
+            throw py::error_already_set{};
+        }
+    } else scalarT = py::cast<T>(t);
+
+    py::object result = quaternionOutput<T>(out, bufferA.size());
+    const PyRowBuffer<T> output{result, "out", true};
+    checkQuaternionRows(output, "out", bufferA.size());
+
+    pyBatch(bufferA.size(), [&]() {
+        for(std::size_t i = 0; i != bufferA.size(); ++i)
+            output.template row<Math::Quaternion<T>>(i) = interpolate(
+                bufferA.template row<Math::Quaternion<T>>(i),
+                bufferB.template row<Math::Quaternion<T>>(i),
+                bufferT ? bufferT->template row<T>(i) : scalarT);
+    });
+
+    return result;
+}
+
+template<class T> py::object normalizedBatch(const py::buffer& quaternions, const py::object& out) {
+    const PyRowBuffer<T> input{quaternions, "quaternions"};
+    checkQuaternionRows(input, "quaternions", input.size());
+
+    py::object result = quaternionOutput<T>(out, input.size());
+    const PyRowBuffer<T> output{result, "out", true};
+    checkQuaternionRows(output, "out", input.size());
+
+    pyBatch(input.size(), [&]() {
+        for(std::size_t i = 0; i != input.size(); ++i)
+            output.template row<Math::Quaternion<T>>(i) = input.template row<Math::Quaternion<T>>(i).normalized();
+    });
+
+    return result;
+}
+
+template<class T> py::object toMatrixBatch(const py::buffer& quaternions, const py::object& out) {
+    const PyRowBuffer<T> input{quaternions, "quaternions"};
+    checkQuaternionRows(input, "quaternions", input.size());
+
+    /* Without an output, allocate a (n, 3, 3) array. The matrices are stored
+       column-major, so the view is strided to index them as [i][row][col],
+       consistently with how single matrices are exposed to numpy. */
+    py::object result = out;
+    if(result.is_none()) {
+        Containers::ArrayView<T> data;
+        py::object owner = py::none{};
+        if(input.size()) {
+            auto* array = new Containers::Array<T>{Containers::NoInit, input.size()*9};
+            owner = py::capsule{array, pyDeleteArray<T>};
+            data = *array;
+        }
+
+        result = pyCastButNotShitty(Containers::pyArrayViewHolder(Containers::StridedArrayView3D<T>{data,
+            {input.size(), 3, 3},
+            {std::ptrdiff_t(9*sizeof(T)), std::ptrdiff_t(sizeof(T)), std::ptrdiff_t(3*sizeof(T))}}, owner));
+    }
+
+    /* GCC 4.8 otherwise loudly complains about missing initializers */
+    Py_buffer buffer{nullptr, nullptr, 0, 0, 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr};
+    if(PyObject_GetBuffer(result.ptr(), &buffer, PyBUF_FORMAT|PyBUF_STRIDES|PyBUF_WRITABLE) != 0)
+        throw py::error_already_set{};
+
+    Containers::ScopeGuard e{&buffer, PyBuffer_Release};
+
+    if(buffer.ndim != 3 || corrade::pyBufferFormatCharacter(buffer) != FormatStrings[formatIndex<T>()][0] || std::size_t(buffer.shape[0]) != input.size() || buffer.shape[1] != buffer.shape[2] || (buffer.shape[1] != 3 && buffer.shape[1] != 4)) {
+        PyErr_Format(PyExc_BufferError, "expected out to be a %s buffer of shape (%zu, 3, 3) or (%zu, 4, 4)", FormatStrings[formatIndex<T>()], input.size(), input.size());
+        throw py::error_already_set{};
+    }
+
+    pyBatch(input.size(), [&]() {
+        const std::size_t size = buffer.shape[1];
+        char* data = static_cast<char*>(buffer.buf);
+        for(std::size_t i = 0; i != input.size(); ++i) {
+            const Math::Matrix4<T> matrix = Math::Matrix4<T>::from(input.template row<Math::Quaternion<T>>(i).toMatrix(), {});
+            for(std::size_t col = 0; col != size; ++col)
+                for(std::size_t row = 0; row != size; ++row)
+                    *reinterpret_cast<T*>(data + i*buffer.strides[0] + row*buffer.strides[1] + col*buffer.strides[2]) = matrix[col][row];
+        }
+    });
+
+    return result;
+}
+
+/* Float or double variant is picked based on the first buffer format. The
+   float variant then fails with a message for anything that's not float. */
+template<py::object(*f)(const py::buffer&, const py::buffer&, const py::object&, const py::object&), py::object(*d)(const py::buffer&, const py::buffer&, const py::object&, const py::object&)> py::object interpolateBatchDispatch(const py::buffer& a, const py::buffer& b, const py::object& t, const py::object& out) {
+    return pyBufferFormat(a) == 'd' ? d(a, b, t, out) : f(a, b, t, out);
+}
+
+void quaternionBatch(py::module& m) {
+    m
+        .def("lerp", interpolateBatchDispatch<interpolateBatch<Float, Math::lerp>, interpolateBatch<Double, Math::lerp>>,
+            "Linear interpolation of quaternions in a buffer", py::arg("normalized_a"), py::arg("normalized_b"), py::arg("t"), py::arg("out") = py::none{})
+        .def("lerp_shortest_path", interpolateBatchDispatch<interpolateBatch<Float, Math::lerpShortestPath>, interpolateBatch<Double, Math::lerpShortestPath>>,
+            "Linear shortest-path interpolation of quaternions in a buffer", py::arg("normalized_a"), py::arg("normalized_b"), py::arg("t"), py::arg("out") = py::none{})
+        .def("slerp", interpolateBatchDispatch<interpolateBatch<Float, Math::slerp>, interpolateBatch<Double, Math::slerp>>,
+            "Spherical linear interpolation of quaternions in a buffer", py::arg("normalized_a"), py::arg("normalized_b"), py::arg("t"), py::arg("out") = py::none{})
+        .def("slerp_shortest_path", interpolateBatchDispatch<interpolateBatch<Float, Math::slerpShortestPath>, interpolateBatch<Double, Math::slerpShortestPath>>,
+            "Spherical linear shortest-path interpolation of quaternions in a buffer", py::arg("normalized_a"), py::arg("normalized_b"), py::arg("t"), py::arg("out") = py::none{})
+        .def("quaternions_normalized", [](const py::buffer& quaternions, const py::object& out) {
+            return pyBufferFormat(quaternions) == 'd' ?
+                normalizedBatch<Double>(quaternions, out) :
+                normalizedBatch<Float>(quaternions, out);
+        }, "Normalize quaternions in a buffer", py::arg("quaternions"), py::arg("out") = py::none{})
+        .def("quaternions_to_matrix", [](const py::buffer& quaternions, const py::object& out) {
+            return pyBufferFormat(quaternions) == 'd' ?
+                toMatrixBatch<Double>(quaternions, out) :
+                toMatrixBatch<Float>(quaternions, out);
+        }, "Convert quaternions in a buffer to rotation matrices", py::arg("quaternions"), py::arg("out") = py::none{});
+}
+
 /* Behaves exactly like Py_Type_Type.tp_getattro but redirects access to the
    translation attribute to _stranslation in order to make it behave like a
    function when called on an object */
@@ -461,6 +604,8 @@ void math(py::module& root, py::module& m) {
     /* These are needed for the quaternion, so register them before. Double
        versions are called from inside these. */
     magnum::mathVectorFloat(root, m);
+    /* Vector arrays need the vector types for item access */
+    magnum::mathVectorArray(root, m);
     /* Matrices need a metaclass in order to support the magic translation
        attribute, so allocate it here, just once. TODO: I'm not sure who's
        responsible for deleting the object, actually -- however neither pybind
@@ -475,6 +620,8 @@ void math(py::module& root, py::module& m) {
     quaternion(m, quaterniond);
     convertible<Quaterniond>(quaternion_);
     convertible<Quaternion>(quaterniond);
+    /* Buffer overloads have to be after the single-quaternion ones */
+    quaternionBatch(m);
 
     /* Range */
     magnum::mathRange(root, m);
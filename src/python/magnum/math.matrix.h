@@ -34,6 +34,8 @@
 #include "corrade/PyBuffer.h"
 
 #include "magnum/math.h"
+#include "magnum/math.operators.h"
+#include "magnum/math.vectorarray.h"
 
 namespace magnum {
 
@@ -270,6 +272,53 @@ template<class U, class T, class ...Args> void convertible(py::class_<T, Args...
     c.def(py::init<U>(), "Construct from different underlying type");
 }
 
+/* Transforms all rows of a (n, dimensions) buffer, or a (n, dimensions + 1)
+   buffer of homogeneous coordinates, with a transformation matrix. Output
+   goes either into a new vector array or into the buffer passed in out. */
+template<class T, class VectorType, VectorType(T::*transform)(const VectorType&) const> py::object transformBatch(const T& self, const py::buffer& vectors, const py::object& out) {
+    typedef typename T::Type Type;
+    typedef typename VectorTraits<T::Size, Type>::Type HomogeneousType;
+
+    /* A one-dimensional buffer is a single vector */
+    if(out.is_none() && pyBufferShape(vectors).size() == 1)
+        return py::cast((self.*transform)(py::cast<VectorType>(vectors)));
+
+    const PyRowBuffer<Type> input{vectors, "input"};
+    const bool homogeneous = input.rowSize() == HomogeneousType::Size;
+    if(input.rowSize() != VectorType::Size && !homogeneous) {
+        PyErr_Format(PyExc_BufferError, "expected input to have %zu or %zu columns but got %zu", std::size_t(VectorType::Size), std::size_t(HomogeneousType::Size), input.rowSize());
+        throw py::error_already_set{};
+    }
+
+    py::object result = out;
+    if(result.is_none()) result = homogeneous ?
+        py::cast(PyVectorArray<HomogeneousType>{input.size()}) :
+        py::cast(PyVectorArray<VectorType>{input.size()});
+
+    const PyRowBuffer<Type> output{result, "out", true};
+    if(output.size() != input.size() || output.rowSize() != input.rowSize()) {
+        PyErr_Format(PyExc_ValueError, "expected out to have shape (%zu, %zu) but got (%zu, %zu)", input.size(), input.rowSize(), output.size(), output.rowSize());
+        throw py::error_already_set{};
+    }
+
+    /* Each row is read fully before being written, so the output can be the
+       input buffer itself. Rows shifted against each other would however
+       overwrite input that wasn't read yet. */
+    if(output.overlapsPartially(input)) {
+        PyErr_SetString(PyExc_ValueError, "out overlaps with input but isn't the same buffer");
+        throw py::error_already_set{};
+    }
+
+    pyBatch(input.size(), [&]() {
+        if(homogeneous) for(std::size_t i = 0; i != input.size(); ++i)
+            output.template row<HomogeneousType>(i) = self*input.template row<HomogeneousType>(i);
+        else for(std::size_t i = 0; i != input.size(); ++i)
+            output.template row<VectorType>(i) = (self.*transform)(input.template row<VectorType>(i));
+    });
+
+    return result;
+}
+
 template<class T> void matrices(
     py::class_<Math::Matrix2x2<T>>& matrix2x2,
     py::class_<Math::Matrix2x3<T>>& matrix2x3,
@@ -599,6 +648,10 @@ template<class T> void matrices(
             "Transform a 2D vector with the matrix")
         .def("transform_point", &Math::Matrix3<T>::transformPoint,
             "Transform a 2D point with the matrix")
+        .def("transform_vector", transformBatch<Math::Matrix3<T>, Math::Vector2<T>, &Math::Matrix3<T>::transformVector>,
+            "Transform 2D vectors in a buffer with the matrix", py::arg("vectors"), py::arg("out") = py::none{})
+        .def("transform_point", transformBatch<Math::Matrix3<T>, Math::Vector2<T>, &Math::Matrix3<T>::transformPoint>,
+            "Transform 2D points in a buffer with the matrix", py::arg("points"), py::arg("out") = py::none{})
 
         /* Properties. The translation is handled below together with a static
            translation(). */
@@ -803,6 +856,10 @@ Overloaded function.
             "Transform a 3D vector with the matrix")
         .def("transform_point", &Math::Matrix4<T>::transformPoint,
             "Transform a 3D point with the matrix")
+        .def("transform_vector", transformBatch<Math::Matrix4<T>, Math::Vector3<T>, &Math::Matrix4<T>::transformVector>,
+            "Transform 3D vectors in a buffer with the matrix", py::arg("vectors"), py::arg("out") = py::none{})
+        .def("transform_point", transformBatch<Math::Matrix4<T>, Math::Vector3<T>, &Math::Matrix4<T>::transformPoint>,
+            "Transform 3D points in a buffer with the matrix", py::arg("points"), py::arg("out") = py::none{})
 
         /* Properties. The translation is handled below together with a static
            translation(). */
@@ -931,6 +988,13 @@ Overloaded function.
         static_cast<Math::Vector3<T>(Math::Matrix4<T>::*)() const>(&Math::Matrix4<T>::translation),
         [](Math::Matrix4<T>& self, const Math::Vector3<T>& value) { self.translation() = value; },
         "3D translation part of the matrix");
+
+    /* Has to be done only after all operators are defined */
+    enableFastMatrixOperators(matrix2x2);
+    enableFastMatrixOperators(matrix3x3);
+    enableFastMatrixOperators(matrix4x4);
+    enableFastMatrixOperators(matrix3);
+    enableFastMatrixOperators(matrix4);
 }
 
 }
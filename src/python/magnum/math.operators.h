@@ -0,0 +1,152 @@
+#ifndef magnum_math_operators_h
+#define magnum_math_operators_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <pybind11/pybind11.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Corrade/Python.h"
+
+#include "magnum/bootstrap.h"
+
+namespace magnum {
+
+/* Operators defined through pybind go through the generic overload
+   resolution, including attempts at implicit conversions from buffers,
+   before the actual operation gets called. That's a lot of overhead for
+   something as cheap as adding two vectors, so the number slots get replaced
+   with functions that handle the common case of both operands being exactly
+   T directly and delegate to the pybind-defined methods otherwise. This has
+   to be done only after all operators are defined on the class, as defining
+   an operator method makes Python reset the corresponding slot. */
+template<class T> struct FastOperators {
+    static PyObject* add(PyObject* a, PyObject* b) {
+        if(isExact(a) && isExact(b))
+            return result(get(a) + get(b));
+        return fallback(a, b, &PyNumberMethods::nb_add, add, "__add__", "__radd__");
+    }
+
+    static PyObject* subtract(PyObject* a, PyObject* b) {
+        if(isExact(a) && isExact(b))
+            return result(get(a) - get(b));
+        return fallback(a, b, &PyNumberMethods::nb_subtract, subtract, "__sub__", "__rsub__");
+    }
+
+    /* Component-wise for vectors, plus multiplication with a float from
+       either side */
+    static PyObject* multiply(PyObject* a, PyObject* b) {
+        if(isExact(a)) {
+            if(isExact(b))
+                return result(get(a)*get(b));
+            if(PyFloat_CheckExact(b))
+                return result(get(a)*typename T::Type(PyFloat_AS_DOUBLE(b)));
+        } else if(isExact(b) && PyFloat_CheckExact(a))
+            return result(typename T::Type(PyFloat_AS_DOUBLE(a))*get(b));
+        return fallback(a, b, &PyNumberMethods::nb_multiply, multiply, "__mul__", "__rmul__");
+    }
+
+    static PyObject* matrixMultiply(PyObject* a, PyObject* b) {
+        if(isExact(a) && isExact(b))
+            return result(get(a)*get(b));
+        return fallback(a, b, &PyNumberMethods::nb_matrix_multiply, matrixMultiply, "__matmul__", "__rmatmul__");
+    }
+
+    static PyTypeObject* type;
+
+    private:
+        static bool isExact(PyObject* obj) { return Py_TYPE(obj) == type; }
+
+        static const T& get(PyObject* obj) {
+            return pyInstanceFromHandle<T>(obj);
+        }
+
+        static PyObject* result(T value) {
+            /* The only thing that can fail here is the allocation of the
+               Python instance */
+            try {
+                return py::detail::make_caster<T>::cast(std::move(value), py::return_value_policy::move, {}).ptr();
+            } catch(py::error_already_set& e) {
+                e.restore();
+                return nullptr;
+            }
+        }
+
+        /* CPython's own slot wrappers call the Python methods only if the
+           slot wasn't replaced, so do the same dispatch they'd do, including
+           the reflected variant for the right-hand operand */
+        static PyObject* fallback(PyObject* a, PyObject* b, binaryfunc PyNumberMethods::*slot, binaryfunc function, const char* name, const char* reflectedName) {
+            if(Py_TYPE(a)->tp_as_number && Py_TYPE(a)->tp_as_number->*slot == function) {
+                PyObject* out = callMethod(a, name, b);
+                if(out != Py_NotImplemented) return out;
+                Py_DECREF(out);
+            }
+            if(Py_TYPE(b) != Py_TYPE(a) && Py_TYPE(b)->tp_as_number && Py_TYPE(b)->tp_as_number->*slot == function)
+                return callMethod(b, reflectedName, a);
+            Py_RETURN_NOTIMPLEMENTED;
+        }
+
+        static PyObject* callMethod(PyObject* obj, const char* name, PyObject* arg) {
+            PyObject* method = PyObject_GetAttrString(obj, name);
+            if(!method) {
+                if(!PyErr_ExceptionMatches(PyExc_AttributeError)) return nullptr;
+                PyErr_Clear();
+                Py_RETURN_NOTIMPLEMENTED;
+            }
+            PyObject* out = PyObject_CallFunctionObjArgs(method, arg, nullptr);
+            Py_DECREF(method);
+            return out;
+        }
+};
+
+template<class T> PyTypeObject* FastOperators<T>::type = nullptr;
+
+template<class T, class ...Args> PyNumberMethods& fastOperatorSlots(py::class_<T, Args...>& c) {
+    auto& typeObject = reinterpret_cast<PyHeapTypeObject&>(*c.ptr());
+    FastOperators<T>::type = &typeObject.ht_type;
+    return typeObject.as_number;
+}
+
+template<class T, class ...Args> void enableFastVectorOperators(py::class_<T, Args...>& c) {
+    PyNumberMethods& slots = fastOperatorSlots(c);
+    /* Sanity check -- we expect Python to set up the slots for the operators
+       pybind defined before us */
+    CORRADE_INTERNAL_ASSERT(slots.nb_add && slots.nb_subtract && slots.nb_multiply);
+    slots.nb_add = FastOperators<T>::add;
+    slots.nb_subtract = FastOperators<T>::subtract;
+    slots.nb_multiply = FastOperators<T>::multiply;
+}
+
+template<class T, class ...Args> void enableFastMatrixOperators(py::class_<T, Args...>& c) {
+    PyNumberMethods& slots = fastOperatorSlots(c);
+    CORRADE_INTERNAL_ASSERT(slots.nb_add && slots.nb_subtract && slots.nb_matrix_multiply);
+    slots.nb_add = FastOperators<T>::add;
+    slots.nb_subtract = FastOperators<T>::subtract;
+    slots.nb_matrix_multiply = FastOperators<T>::matrixMultiply;
+}
+
+}
+
+#endif
@@ -26,15 +26,50 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/operators.h>
 #include <Magnum/Magnum.h>
+#include <Magnum/Math/Functions.h>
 #include <Magnum/Math/Range.h>
 
 #include "magnum/bootstrap.h"
 #include "magnum/math.h"
+#include "magnum/math.vectorarray.h"
 
 namespace magnum {
 
 namespace {
 
+/* Writes a predicate result for each item as a byte into a new bytearray or
+   into a one-dimensional bool or byte buffer passed in out. Not using the
+   char array views because those convert items to single-character strings,
+   which isn't useful for a mask. */
+template<class F> py::object maskBatch(const py::object& out, std::size_t size, F predicate) {
+    py::object result = out;
+    if(result.is_none()) {
+        result = py::reinterpret_steal<py::object>(PyByteArray_FromStringAndSize(nullptr, size));
+        if(!result) throw py::error_already_set{};
+    }
+
+    /* GCC 4.8 otherwise loudly complains about missing initializers */
+    Py_buffer buffer{nullptr, nullptr, 0, 0, 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr};
+    if(PyObject_GetBuffer(result.ptr(), &buffer, PyBUF_FORMAT|PyBUF_STRIDES|PyBUF_WRITABLE) != 0)
+        throw py::error_already_set{};
+
+    Containers::ScopeGuard e{&buffer, PyBuffer_Release};
+
+    const char* format = buffer.format ? buffer.format : "B";
+    if(buffer.ndim != 1 || buffer.itemsize != 1 || std::size_t(buffer.shape[0]) != size || (format[0] != '?' && format[0] != 'B' && format[0] != 'b') || format[1]) {
+        PyErr_Format(PyExc_BufferError, "expected out to be a one-dimensional bool or byte buffer of size %zu", size);
+        throw py::error_already_set{};
+    }
+
+    pyBatch(size, [&]() {
+        char* data = static_cast<char*>(buffer.buf);
+        for(std::size_t i = 0; i != size; ++i)
+            data[i*buffer.strides[0]] = predicate(i);
+    });
+
+    return result;
+}
+
 template<class T> void range(py::module& m, py::class_<T>& c) {
     /*
         Missing APIs:
@@ -170,6 +205,73 @@ template<class T> void range2D(py::class_<T>& c) {
         .def("center_y", &T::sizeY, "Range center on Y axis");
 }
 
+/* Batch operations for 2D and 3D ranges. Points are passed as (n, dimensions)
+   buffers and ranges as (n, 2, dimensions) buffers of minimal and maximal
+   coordinates, which matches their memory layout so the rows can be accessed
+   directly. */
+template<class T> void rangeBatch(py::module& m, py::class_<T>& c) {
+    typedef typename T::VectorType VectorType;
+    typedef typename VectorType::Type Type;
+
+    c.def("contains", [](const T& self, const py::buffer& points, const py::object& out) {
+        /* A one-dimensional buffer is a single point */
+        if(out.is_none() && pyBufferShape(points).size() == 1)
+            return py::cast(self.contains(py::cast<VectorType>(points)));
+
+        const PyRowBuffer<Type> input{points, "points"};
+        if(input.rowSize() != VectorType::Size) {
+            PyErr_Format(PyExc_BufferError, "expected points to have %zu columns but got %zu", std::size_t(VectorType::Size), input.rowSize());
+            throw py::error_already_set{};
+        }
+
+        return maskBatch(out, input.size(), [&](std::size_t i) {
+            return self.contains(input.template row<VectorType>(i));
+        });
+    }, "Whether points in a buffer are contained inside the range", py::arg("points"), py::arg("out") = py::none{});
+
+    c.def_static("from_points", [](const py::buffer& points) {
+        const PyRowBuffer<Type> input{points, "points"};
+        if(input.rowSize() != VectorType::Size) {
+            PyErr_Format(PyExc_BufferError, "expected points to have %zu columns but got %zu", std::size_t(VectorType::Size), input.rowSize());
+            throw py::error_already_set{};
+        }
+        if(!input.size()) {
+            PyErr_SetString(PyExc_ValueError, "expected at least one point");
+            throw py::error_already_set{};
+        }
+
+        T out{input.template row<VectorType>(0), input.template row<VectorType>(0)};
+        pyBatch(input.size(), [&]() {
+            for(std::size_t i = 1; i != input.size(); ++i) {
+                const VectorType& point = input.template row<VectorType>(i);
+                out.min() = Math::min(out.min(), point);
+                out.max() = Math::max(out.max(), point);
+            }
+        });
+        return out;
+    }, "Bounds of points in a buffer", py::arg("points"));
+
+    m.def("intersects", [](const T& a, const py::buffer& b, const py::object& out) {
+        /* A (2, dimensions) buffer is a single range */
+        const std::vector<std::size_t> shape = pyBufferShape(b);
+        if(out.is_none() && shape.size() == 2 && shape[0] == 2 && shape[1] == VectorType::Size)
+            return py::cast(Math::intersects(a, py::cast<T>(b)));
+
+        /* Only (n, 2, dimensions) is accepted, a (n, dimensions, 2) buffer
+           has the same size but a different meaning */
+        if(shape.size() != 3 || shape[1] != 2 || shape[2] != VectorType::Size) {
+            PyErr_Format(PyExc_BufferError, "expected b to have shape (n, 2, %zu)", std::size_t(VectorType::Size));
+            throw py::error_already_set{};
+        }
+
+        const PyRowBuffer<Type> input{b, "b", false, 2};
+
+        return maskBatch(out, input.size(), [&](std::size_t i) {
+            return Math::intersects(a, input.template row<T>(i));
+        });
+    }, "Whether a range intersects ranges in a buffer", py::arg("a"), py::arg("b"), py::arg("out") = py::none{});
+}
+
 template<class T> void range3D(py::class_<T>& c) {
     py::implicitly_convertible<std::pair<std::tuple<typename T::VectorType::Type, typename T::VectorType::Type, typename T::VectorType::Type>, std::tuple<typename T::VectorType::Type, typename T::VectorType::Type, typename T::VectorType::Type>>, T>();
 
@@ -358,6 +460,14 @@ void mathRange(py::module& root, py::module& m) {
     range3D(range3D_);
     range3D(range3Di);
     range3D(range3Dd);
+
+    /* Buffer overloads have to be after the single-range ones */
+    rangeBatch(m, range2D_);
+    rangeBatch(m, range2Di);
+    rangeBatch(m, range2Dd);
+    rangeBatch(m, range3D_);
+    rangeBatch(m, range3Di);
+    rangeBatch(m, range3Dd);
 }
 
 }
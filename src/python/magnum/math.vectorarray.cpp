@@ -0,0 +1,265 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <pybind11/operators.h>
+#include <Magnum/Math/Vector4.h>
+
+#include "corrade/PyBuffer.h"
+
+#include "magnum/math.vectorarray.h"
+
+namespace magnum {
+
+namespace {
+
+template<class T> bool vectorArrayBufferProtocol(PyVectorArray<T>& self, Py_buffer& buffer, int flags) {
+    buffer.ndim = 2;
+    buffer.itemsize = sizeof(typename T::Type);
+    buffer.len = self.data.size()*sizeof(T);
+    buffer.buf = self.data.data();
+    buffer.readonly = false;
+    if((flags & PyBUF_FORMAT) == PyBUF_FORMAT)
+        buffer.format = const_cast<char*>(FormatStrings[formatIndex<typename T::Type>()]);
+    if(flags != PyBUF_SIMPLE) {
+        buffer.shape = self.shape;
+        if((flags & PyBUF_STRIDES) == PyBUF_STRIDES)
+            buffer.strides = self.strides;
+    }
+
+    return true;
+}
+
+/* The kernels operate on flat arrays of components so they're trivially
+   vectorizable by the compiler */
+template<class T, class F> PyVectorArray<T> componentwise(const PyVectorArray<T>& a, const PyVectorArray<T>& b, F f) {
+    checkSameSize(a, b);
+    PyVectorArray<T> out{a.data.size()};
+    typename T::Type* o = out.components();
+    const typename T::Type* x = a.components();
+    const typename T::Type* y = b.components();
+    for(std::size_t i = 0, max = out.componentCount(); i != max; ++i)
+        o[i] = f(x[i], y[i]);
+    return out;
+}
+
+template<class T, class F> PyVectorArray<T>& componentwiseInPlace(PyVectorArray<T>& a, const PyVectorArray<T>& b, F f) {
+    checkSameSize(a, b);
+    typename T::Type* x = a.components();
+    const typename T::Type* y = b.components();
+    for(std::size_t i = 0, max = a.componentCount(); i != max; ++i)
+        x[i] = f(x[i], y[i]);
+    return a;
+}
+
+template<class T, class F> PyVectorArray<T> scalarwise(const PyVectorArray<T>& a, typename T::Type b, F f) {
+    PyVectorArray<T> out{a.data.size()};
+    typename T::Type* o = out.components();
+    const typename T::Type* x = a.components();
+    for(std::size_t i = 0, max = out.componentCount(); i != max; ++i)
+        o[i] = f(x[i], b);
+    return out;
+}
+
+template<class T, class F> PyVectorArray<T>& scalarwiseInPlace(PyVectorArray<T>& a, typename T::Type b, F f) {
+    typename T::Type* x = a.components();
+    for(std::size_t i = 0, max = a.componentCount(); i != max; ++i)
+        x[i] = f(x[i], b);
+    return a;
+}
+
+/* Operations with a single vector applied to all items */
+template<class T, class F> PyVectorArray<T> vectorwise(const PyVectorArray<T>& a, const T& b, F f) {
+    PyVectorArray<T> out{a.data.size()};
+    for(std::size_t i = 0; i != out.data.size(); ++i)
+        for(std::size_t j = 0; j != T::Size; ++j)
+            out.data[i][j] = f(a.data[i][j], b[j]);
+    return out;
+}
+
+template<class T> Containers::Array<typename T::Type> dots(const PyVectorArray<T>& a, const PyVectorArray<T>& b) {
+    checkSameSize(a, b);
+    Containers::Array<typename T::Type> out{Containers::NoInit, a.data.size()};
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = Math::dot(a.data[i], b.data[i]);
+    return out;
+}
+
+template<class T> void vectorArray(py::module& m, py::class_<PyVectorArray<T>>& c) {
+    typedef typename T::Type Type;
+    typedef PyVectorArray<T> A;
+
+    m
+        .def("dot", [](const A& a, const A& b) {
+            return pyOwnedArrayView(dots(a, b));
+        }, "Dot products of two vector arrays");
+
+    c
+        /* Constructors */
+        .def(py::init([](std::size_t size) {
+            A out{size};
+            for(T& i: out.data) i = T{Math::ZeroInit};
+            return out;
+        }), "Construct a zero-initialized array", py::arg("size"))
+        .def(py::init([](py::buffer other) {
+            return pyVectorArrayFromBuffer<T>(other);
+        }), "Construct a copy of a buffer")
+
+        /* Length, item access. Need to raise IndexError in order to allow
+           iteration. */
+        .def("__len__", [](const A& self) {
+            return self.data.size();
+        }, "Array size")
+        .def("__getitem__", [](const A& self, std::size_t i) {
+            if(i >= self.data.size()) {
+                PyErr_SetNone(PyExc_IndexError);
+                throw py::error_already_set{};
+            }
+            return self.data[i];
+        }, "Vector at given position")
+        .def("__setitem__", [](A& self, std::size_t i, const T& value) {
+            if(i >= self.data.size()) {
+                PyErr_SetNone(PyExc_IndexError);
+                throw py::error_already_set{};
+            }
+            self.data[i] = value;
+        }, "Set a vector at given position")
+
+        /* Operators. Array overloads go first so they get picked without
+           attempting the implicit buffer conversion to a single vector. */
+        .def("__add__", [](const A& self, const A& other) {
+            return componentwise(self, other, [](Type a, Type b) { return a + b; });
+        }, "Add an array component-wise", py::is_operator{})
+        .def("__add__", [](const A& self, const T& other) {
+            return vectorwise(self, other, [](Type a, Type b) { return a + b; });
+        }, "Add a vector to all items", py::is_operator{})
+        .def("__iadd__", [](A& self, const A& other) -> A& {
+            return componentwiseInPlace(self, other, [](Type a, Type b) { return a + b; });
+        }, "Add and assign an array component-wise", py::is_operator{})
+        .def("__sub__", [](const A& self, const A& other) {
+            return componentwise(self, other, [](Type a, Type b) { return a - b; });
+        }, "Subtract an array component-wise", py::is_operator{})
+        .def("__sub__", [](const A& self, const T& other) {
+            return vectorwise(self, other, [](Type a, Type b) { return a - b; });
+        }, "Subtract a vector from all items", py::is_operator{})
+        .def("__isub__", [](A& self, const A& other) -> A& {
+            return componentwiseInPlace(self, other, [](Type a, Type b) { return a - b; });
+        }, "Subtract and assign an array component-wise", py::is_operator{})
+        .def("__mul__", [](const A& self, const A& other) {
+            return componentwise(self, other, [](Type a, Type b) { return a*b; });
+        }, "Multiply an array component-wise", py::is_operator{})
+        .def("__mul__", [](const A& self, const T& other) {
+            return vectorwise(self, other, [](Type a, Type b) { return a*b; });
+        }, "Multiply all items with a vector component-wise", py::is_operator{})
+        .def("__mul__", [](const A& self, Type other) {
+            return scalarwise(self, other, [](Type a, Type b) { return a*b; });
+        }, "Multiply with a scalar", py::is_operator{})
+        .def("__rmul__", [](const A& self, Type other) {
+            return scalarwise(self, other, [](Type a, Type b) { return b*a; });
+        }, "Multiply a scalar with an array", py::is_operator{})
+        .def("__imul__", [](A& self, const A& other) -> A& {
+            return componentwiseInPlace(self, other, [](Type a, Type b) { return a*b; });
+        }, "Multiply an array component-wise and assign", py::is_operator{})
+        .def("__imul__", [](A& self, Type other) -> A& {
+            return scalarwiseInPlace(self, other, [](Type a, Type b) { return a*b; });
+        }, "Multiply with a scalar and assign", py::is_operator{})
+        .def("__truediv__", [](const A& self, const A& other) {
+            return componentwise(self, other, [](Type a, Type b) { return a/b; });
+        }, "Divide an array component-wise", py::is_operator{})
+        .def("__truediv__", [](const A& self, const T& other) {
+            return vectorwise(self, other, [](Type a, Type b) { return a/b; });
+        }, "Divide all items with a vector component-wise", py::is_operator{})
+        .def("__truediv__", [](const A& self, Type other) {
+            return scalarwise(self, other, [](Type a, Type b) { return a/b; });
+        }, "Divide with a scalar", py::is_operator{})
+        .def("__rtruediv__", [](const A& self, Type other) {
+            return scalarwise(self, other, [](Type a, Type b) { return b/a; });
+        }, "Divide a scalar with an array and invert", py::is_operator{})
+        .def("__itruediv__", [](A& self, const A& other) -> A& {
+            return componentwiseInPlace(self, other, [](Type a, Type b) { return a/b; });
+        }, "Divide an array component-wise and assign", py::is_operator{})
+        .def("__itruediv__", [](A& self, Type other) -> A& {
+            return scalarwiseInPlace(self, other, [](Type a, Type b) { return a/b; });
+        }, "Divide with a scalar and assign", py::is_operator{})
+        .def("__neg__", [](const A& self) {
+            return scalarwise(self, Type(-1), [](Type a, Type b) { return a*b; });
+        }, "Negated array", py::is_operator{})
+
+        /* Member functions */
+        .def("dot", [](const A& self) {
+            return pyOwnedArrayView(dots(self, self));
+        }, "Dot products of all vectors with themselves")
+        .def("length", [](const A& self) {
+            Containers::Array<Type> out{Containers::NoInit, self.data.size()};
+            for(std::size_t i = 0; i != out.size(); ++i)
+                out[i] = self.data[i].length();
+            return pyOwnedArrayView(std::move(out));
+        }, "Vector lengths")
+        .def("normalized", [](const A& self) {
+            A out{self.data.size()};
+            for(std::size_t i = 0; i != out.data.size(); ++i)
+                out.data[i] = self.data[i].normalized();
+            return out;
+        }, "Normalized vectors (of unit length)");
+
+    corrade::enableBetterBufferProtocol<A, vectorArrayBufferProtocol>(c);
+}
+
+template<class T> void vectorArraysFloat(py::module& m, py::class_<PyVectorArray<Math::Vector2<T>>>& vector2Array, py::class_<PyVectorArray<Math::Vector3<T>>>& vector3Array, py::class_<PyVectorArray<Math::Vector4<T>>>& vector4Array) {
+    vectorArray(m, vector2Array);
+    vectorArray(m, vector3Array);
+    vectorArray(m, vector4Array);
+
+    m
+        .def("cross", [](const PyVectorArray<Math::Vector2<T>>& a, const PyVectorArray<Math::Vector2<T>>& b) {
+            checkSameSize(a, b);
+            Containers::Array<T> out{Containers::NoInit, a.data.size()};
+            for(std::size_t i = 0; i != out.size(); ++i)
+                out[i] = Math::cross(a.data[i], b.data[i]);
+            return pyOwnedArrayView(std::move(out));
+        }, "2D cross products of two vector arrays")
+        .def("cross", [](const PyVectorArray<Math::Vector3<T>>& a, const PyVectorArray<Math::Vector3<T>>& b) {
+            checkSameSize(a, b);
+            PyVectorArray<Math::Vector3<T>> out{a.data.size()};
+            for(std::size_t i = 0; i != out.data.size(); ++i)
+                out.data[i] = Math::cross(a.data[i], b.data[i]);
+            return out;
+        }, "Cross products of two vector arrays");
+}
+
+}
+
+void mathVectorArray(py::module& root, py::module& m) {
+    py::class_<PyVectorArray<Vector2>> vector2Array{root, "Vector2Array", "Array of two-component float vectors", py::buffer_protocol{}};
+    py::class_<PyVectorArray<Vector3>> vector3Array{root, "Vector3Array", "Array of three-component float vectors", py::buffer_protocol{}};
+    py::class_<PyVectorArray<Vector4>> vector4Array{root, "Vector4Array", "Array of four-component float vectors", py::buffer_protocol{}};
+    py::class_<PyVectorArray<Vector2d>> vector2dArray{root, "Vector2dArray", "Array of two-component double vectors", py::buffer_protocol{}};
+    py::class_<PyVectorArray<Vector3d>> vector3dArray{root, "Vector3dArray", "Array of three-component double vectors", py::buffer_protocol{}};
+    py::class_<PyVectorArray<Vector4d>> vector4dArray{root, "Vector4dArray", "Array of four-component double vectors", py::buffer_protocol{}};
+
+    vectorArraysFloat<Float>(m, vector2Array, vector3Array, vector4Array);
+    vectorArraysFloat<Double>(m, vector2dArray, vector3dArray, vector4dArray);
+}
+
+}
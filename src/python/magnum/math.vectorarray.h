@@ -0,0 +1,235 @@
+#ifndef magnum_math_vectorarray_h
+#define magnum_math_vectorarray_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <utility>
+#include <vector>
+#include <pybind11/pybind11.h>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/ScopeGuard.h>
+#include <Magnum/Math/Vector.h>
+
+#include "Corrade/Containers/Python.h"
+
+#include "corrade/PyBuffer.h"
+#include "magnum/math.h"
+
+namespace magnum {
+
+/* Contiguous array of vectors, exposed as a buffer of shape (n, T::Size). The
+   size is fixed for the whole lifetime, so the shape and strides can be
+   stored alongside and pointed to from Py_buffer. */
+template<class T> struct PyVectorArray {
+    explicit PyVectorArray(std::size_t size): data{Containers::NoInit, size}, shape{Py_ssize_t(size), Py_ssize_t(T::Size)}, strides{Py_ssize_t(sizeof(T)), Py_ssize_t(sizeof(typename T::Type))} {}
+
+    /* Components of all vectors as a flat array, for kernels that don't
+       care about vector boundaries */
+    typename T::Type* components() {
+        return reinterpret_cast<typename T::Type*>(data.data());
+    }
+    const typename T::Type* components() const {
+        return reinterpret_cast<const typename T::Type*>(data.data());
+    }
+    std::size_t componentCount() const { return data.size()*T::Size; }
+
+    Containers::Array<T> data;
+    Py_ssize_t shape[2];
+    Py_ssize_t strides[2];
+};
+
+/* Copies a buffer of shape (n, T::Size) and float or double items into a new
+   array, converting the items if needed */
+template<class T> PyVectorArray<T> pyVectorArrayFromBuffer(py::handle other) {
+    /* GCC 4.8 otherwise loudly complains about missing initializers */
+    Py_buffer buffer{nullptr, nullptr, 0, 0, 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr};
+    if(PyObject_GetBuffer(other.ptr(), &buffer, PyBUF_FORMAT|PyBUF_STRIDES) != 0)
+        throw py::error_already_set{};
+
+    Containers::ScopeGuard e{&buffer, PyBuffer_Release};
+
+    if(buffer.ndim != 2 || std::size_t(buffer.shape[1]) != T::Size) {
+        PyErr_Format(PyExc_BufferError, "expected a buffer of shape (n, %zu)", std::size_t(T::Size));
+        throw py::error_already_set{};
+    }
+
+    /* Expecting just an one-letter format in native byte order */
+    const char format = corrade::pyBufferFormatCharacter(buffer);
+    if(format != 'f' && format != 'd') {
+        PyErr_Format(PyExc_BufferError, "unexpected format %s for a %s vector array", buffer.format, FormatStrings[formatIndex<typename T::Type>()]);
+        throw py::error_already_set{};
+    }
+
+    PyVectorArray<T> out{std::size_t(buffer.shape[0])};
+    const char* data = static_cast<const char*>(buffer.buf);
+    for(std::size_t i = 0; i != out.data.size(); ++i) {
+        for(std::size_t j = 0; j != T::Size; ++j) {
+            const char* item = data + i*buffer.strides[0] + j*buffer.strides[1];
+            out.data[i][j] = format == 'f' ?
+                typename T::Type(*reinterpret_cast<const Float*>(item)) :
+                typename T::Type(*reinterpret_cast<const Double*>(item));
+        }
+    }
+
+    return out;
+}
+
+template<class T> void pyDeleteArray(void* data) {
+    delete static_cast<Containers::Array<T>*>(data);
+}
+
+/* Wraps an array of scalars in a mutable typed view that owns the memory */
+template<class T> Containers::PyArrayViewHolder<Containers::ArrayView<T>> pyOwnedArrayView(Containers::Array<T>&& data) {
+    if(data.empty()) return Containers::pyArrayViewHolder(Containers::ArrayView<T>{}, py::none{});
+
+    auto* owned = new Containers::Array<T>{std::move(data)};
+    return Containers::pyArrayViewHolder(Containers::ArrayView<T>{*owned}, py::capsule{owned, pyDeleteArray<T>});
+}
+
+/* Buffer of shape (n, m) with items of exactly type T and contiguous rows,
+   accessed as vectors of m components without a copy. A buffer of shape (n)
+   is treated as (n, 1). If rows is non-zero, the buffer is expected to have
+   a shape of (n, rows, m) instead and is treated as (n, rows*m). Released on
+   destruction. */
+template<class T> class PyRowBuffer {
+    public:
+        explicit PyRowBuffer(py::handle object, const char* name, bool writable = false, std::size_t rows = 0) {
+            if(PyObject_GetBuffer(object.ptr(), &_buffer, PyBUF_FORMAT|PyBUF_STRIDES|(writable ? PyBUF_WRITABLE : 0)) != 0)
+                throw py::error_already_set{};
+
+            /* Expecting just an one-letter format in native byte order */
+            const char format = corrade::pyBufferFormatCharacter(_buffer);
+            bool contiguous;
+            if(rows)
+                contiguous = _buffer.ndim == 3 && std::size_t(_buffer.shape[1]) == rows && std::size_t(_buffer.strides[2]) == sizeof(T) && std::size_t(_buffer.strides[1]) == _buffer.shape[2]*sizeof(T);
+            else if(_buffer.ndim == 1)
+                contiguous = true;
+            else if(_buffer.ndim == 2)
+                contiguous = std::size_t(_buffer.strides[1]) == sizeof(T);
+            else contiguous = false;
+            if(!contiguous || format != FormatStrings[formatIndex<T>()][0]) {
+                PyBuffer_Release(&_buffer);
+                if(rows)
+                    PyErr_Format(PyExc_BufferError, "expected %s to be a %s buffer of shape (n, %zu, m) with contiguous rows", name, FormatStrings[formatIndex<T>()], rows);
+                else
+                    PyErr_Format(PyExc_BufferError, "expected %s to be a %s buffer of shape (n, m) with contiguous rows", name, FormatStrings[formatIndex<T>()]);
+                throw py::error_already_set{};
+            }
+        }
+
+        ~PyRowBuffer() { PyBuffer_Release(&_buffer); }
+
+        PyRowBuffer(const PyRowBuffer&) = delete;
+        PyRowBuffer& operator=(const PyRowBuffer&) = delete;
+
+        std::size_t size() const { return _buffer.shape[0]; }
+        std::size_t rowSize() const {
+            if(_buffer.ndim == 3) return _buffer.shape[1]*_buffer.shape[2];
+            return _buffer.ndim == 2 ? _buffer.shape[1] : 1;
+        }
+
+        template<class V> V& row(std::size_t i) const {
+            return *reinterpret_cast<V*>(static_cast<char*>(_buffer.buf) + i*_buffer.strides[0]);
+        }
+
+        /* Whether the memory spanned by the rows overlaps with other buffer
+           without the rows being at exactly the same positions */
+        bool overlapsPartially(const PyRowBuffer<T>& other) const {
+            if(!size() || !other.size()) return false;
+            if(_buffer.buf == other._buffer.buf && _buffer.strides[0] == other._buffer.strides[0] && size() == other.size())
+                return false;
+            const std::pair<const char*, const char*> a = span();
+            const std::pair<const char*, const char*> b = other.span();
+            return a.first < b.second && b.first < a.second;
+        }
+
+    private:
+        /* Begin and end of the memory spanned by the rows, strides can be
+           negative */
+        std::pair<const char*, const char*> span() const {
+            const char* first = static_cast<const char*>(_buffer.buf);
+            const char* last = first + (size() - 1)*_buffer.strides[0];
+            if(last < first) std::swap(first, last);
+            return {first, last + rowSize()*sizeof(T)};
+        }
+
+        /* GCC 4.8 otherwise loudly complains about missing initializers */
+        Py_buffer _buffer{nullptr, nullptr, 0, 0, 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr};
+};
+
+/* Shape of a buffer, empty if the object isn't a buffer. Pybind tries all
+   overloads without implicit conversions first, so a batch overload taking
+   a buffer gets picked even for buffers that were meant to be converted to a
+   single vector. The batch functions use this to delegate such buffers to
+   the single-item variant. */
+inline std::vector<std::size_t> pyBufferShape(py::handle object) {
+    /* GCC 4.8 otherwise loudly complains about missing initializers */
+    Py_buffer buffer{nullptr, nullptr, 0, 0, 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr};
+    if(PyObject_GetBuffer(object.ptr(), &buffer, PyBUF_STRIDES) != 0) {
+        PyErr_Clear();
+        return {};
+    }
+
+    std::vector<std::size_t> out{buffer.shape, buffer.shape + buffer.ndim};
+    PyBuffer_Release(&buffer);
+    return out;
+}
+
+/* One-letter item format of a buffer without the byte order prefix, or 0 if
+   the object isn't a buffer or the format is more complex. Used to pick a
+   float or a double variant of a batch function. */
+inline char pyBufferFormat(py::handle object) {
+    /* GCC 4.8 otherwise loudly complains about missing initializers */
+    Py_buffer buffer{nullptr, nullptr, 0, 0, 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr};
+    if(PyObject_GetBuffer(object.ptr(), &buffer, PyBUF_FORMAT|PyBUF_STRIDES) != 0) {
+        PyErr_Clear();
+        return 0;
+    }
+
+    const char out = corrade::pyBufferFormatCharacter(buffer);
+    PyBuffer_Release(&buffer);
+    return out;
+}
+
+/* Runs a batch kernel, releasing the GIL if the batch is large enough for it
+   to be worth it. The kernel is not allowed to touch any Python objects. */
+template<class F> void pyBatch(std::size_t size, F kernel) {
+    if(size >= 4096) {
+        py::gil_scoped_release release;
+        kernel();
+    } else kernel();
+}
+
+template<class T> void checkSameSize(const PyVectorArray<T>& a, const PyVectorArray<T>& b) {
+    if(a.data.size() != b.data.size()) {
+        PyErr_Format(PyExc_ValueError, "expected arrays of the same size but got %zu and %zu", a.data.size(), b.data.size());
+        throw py::error_already_set{};
+    }
+}
+
+}
+
+#endif
@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include "magnum/math.operators.h"
 #include "magnum/math.vector.h"
 
 namespace magnum {
@@ -77,6 +78,11 @@ template<class T> void vectorsFloat(py::module& m, py::class_<Math::Vector2<T>>&
     vector<Math::Vector4<T>>(m, vector4_);
     vectorFloat<Math::Vector4<T>>(m, vector4_);
     vector4<T>(vector4_);
+
+    /* Has to be done only after all operators are defined */
+    enableFastVectorOperators(vector2_);
+    enableFastVectorOperators(vector3_);
+    enableFastVectorOperators(vector4_);
 }
 
 }
@@ -141,6 +147,8 @@ void mathVectorFloat(py::module& root, py::module& m) {
     everyVectorSigned(color4_);
     color(color4_);
     color4(color4_);
+    enableFastVectorOperators(color3_);
+    enableFastVectorOperators(color4_);
 }
 
 }
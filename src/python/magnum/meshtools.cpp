@@ -51,12 +51,14 @@ void meshtools(py::module& m) {
         .value("GENERATE_SMOOTH_NORMALS", MeshTools::CompileFlag::GenerateSmoothNormals);
     corrade::enumOperators(compileFlag);
 
+    /* Compilation doesn't touch any Python state, so the GIL is released to
+       let other threads run while the data are processed and uploaded */
     m
         .def("compile", static_cast<GL::Mesh(*)(const Trade::MeshData2D& data)>(&MeshTools::compile),
-            "Compile 2D mesh data", py::arg("mesh_data"))
+            "Compile 2D mesh data", py::call_guard<py::gil_scoped_release>(), py::arg("mesh_data"))
         .def("compile", [](const Trade::MeshData3D& meshData, MeshTools::CompileFlag flags) {
             return MeshTools::compile(meshData, flags);
-        }, "Compile 3D mesh data", py::arg("mesh_data"), py::arg("flags") = MeshTools::CompileFlag{});
+        }, "Compile 3D mesh data", py::call_guard<py::gil_scoped_release>(), py::arg("mesh_data"), py::arg("flags") = MeshTools::CompileFlag{});
 }
 
 }
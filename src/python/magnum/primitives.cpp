@@ -94,23 +94,25 @@ void primitives(py::module& m) {
         .value("DONT_GENERATE", Primitives::UVSphereTextureCoords::DontGenerate)
         .value("GENERATE", Primitives::UVSphereTextureCoords::Generate);
 
+    /* Primitives with configurable subdivision can take a while to generate,
+       so these release the GIL to let other threads run meanwhile */
     m
         .def("axis2d", Primitives::axis2D, "2D axis")
         .def("axis3d", Primitives::axis3D, "3D axis")
 
-        .def("capsule2d_wireframe", Primitives::capsule2DWireframe, "Wireframe 2D capsule", py::arg("hemisphere_rings"), py::arg("cylinder_rings"), py::arg("half_length"))
-        .def("capsule3d_solid", Primitives::capsule3DSolid, "Solid 3D capsule", py::arg("hemisphere_rings"), py::arg("cylinder_rings"), py::arg("segments"), py::arg("half_length"), py::arg("texture_coords") = Primitives::CapsuleTextureCoords::DontGenerate)
-        .def("capsule3d_wireframe", Primitives::capsule3DWireframe, "Wireframe 3D capsule", py::arg("hemisphere_rings"), py::arg("cylinder_rings"), py::arg("segments"), py::arg("half_length"))
+        .def("capsule2d_wireframe", Primitives::capsule2DWireframe, "Wireframe 2D capsule", py::call_guard<py::gil_scoped_release>(), py::arg("hemisphere_rings"), py::arg("cylinder_rings"), py::arg("half_length"))
+        .def("capsule3d_solid", Primitives::capsule3DSolid, "Solid 3D capsule", py::call_guard<py::gil_scoped_release>(), py::arg("hemisphere_rings"), py::arg("cylinder_rings"), py::arg("segments"), py::arg("half_length"), py::arg("texture_coords") = Primitives::CapsuleTextureCoords::DontGenerate)
+        .def("capsule3d_wireframe", Primitives::capsule3DWireframe, "Wireframe 3D capsule", py::call_guard<py::gil_scoped_release>(), py::arg("hemisphere_rings"), py::arg("cylinder_rings"), py::arg("segments"), py::arg("half_length"))
 
-        .def("circle2d_solid", Primitives::circle2DSolid, "Solid 2D circle", py::arg("segments"), py::arg("texture_coords") = Primitives::CircleTextureCoords::DontGenerate)
-        .def("circle2d_wireframe", Primitives::circle2DWireframe, "Wireframe 2D circle", py::arg("segments"))
-        .def("circle3d_solid", Primitives::circle3DSolid, "Solid 3D circle", py::arg("segments"), py::arg("texture_coords") = Primitives::CircleTextureCoords::DontGenerate)
-        .def("circle3d_wireframe", Primitives::circle3DWireframe, "Wireframe 3D circle", py::arg("segments"))
+        .def("circle2d_solid", Primitives::circle2DSolid, "Solid 2D circle", py::call_guard<py::gil_scoped_release>(), py::arg("segments"), py::arg("texture_coords") = Primitives::CircleTextureCoords::DontGenerate)
+        .def("circle2d_wireframe", Primitives::circle2DWireframe, "Wireframe 2D circle", py::call_guard<py::gil_scoped_release>(), py::arg("segments"))
+        .def("circle3d_solid", Primitives::circle3DSolid, "Solid 3D circle", py::call_guard<py::gil_scoped_release>(), py::arg("segments"), py::arg("texture_coords") = Primitives::CircleTextureCoords::DontGenerate)
+        .def("circle3d_wireframe", Primitives::circle3DWireframe, "Wireframe 3D circle", py::call_guard<py::gil_scoped_release>(), py::arg("segments"))
 
         .def("cone_solid", [](UnsignedInt rings, UnsignedInt segments, Float halfLength, Primitives::ConeFlag flags) {
             return Primitives::coneSolid(rings, segments, halfLength, flags);
-        }, "Solid 3D cone", py::arg("rings"), py::arg("segments"), py::arg("half_length"), py::arg("flags") = Primitives::ConeFlag{})
-        .def("cone_wireframe", Primitives::coneWireframe, "Wireframe 3D cone", py::arg("segments"), py::arg("half_length"))
+        }, "Solid 3D cone", py::call_guard<py::gil_scoped_release>(), py::arg("rings"), py::arg("segments"), py::arg("half_length"), py::arg("flags") = Primitives::ConeFlag{})
+        .def("cone_wireframe", Primitives::coneWireframe, "Wireframe 3D cone", py::call_guard<py::gil_scoped_release>(), py::arg("segments"), py::arg("half_length"))
 
         .def("crosshair2d", Primitives::crosshair2D, "2D crosshair")
         .def("crosshair3d", Primitives::crosshair3D, "3D crosshair")
@@ -121,8 +123,8 @@ void primitives(py::module& m) {
 
         .def("cylinder_solid", [](UnsignedInt rings, UnsignedInt segments, Float halfLength, Primitives::CylinderFlag flags) {
             return Primitives::cylinderSolid(rings, segments, halfLength, flags);
-        }, "Solid 3D cylinder", py::arg("rings"), py::arg("segments"), py::arg("half_length"), py::arg("flags") = Primitives::CylinderFlag{})
-        .def("cylinder_wireframe", Primitives::cylinderWireframe, "Wireframe 3D cylinder", py::arg("rings"), py::arg("segments"), py::arg("half_length"))
+        }, "Solid 3D cylinder", py::call_guard<py::gil_scoped_release>(), py::arg("rings"), py::arg("segments"), py::arg("half_length"), py::arg("flags") = Primitives::CylinderFlag{})
+        .def("cylinder_wireframe", Primitives::cylinderWireframe, "Wireframe 3D cylinder", py::call_guard<py::gil_scoped_release>(), py::arg("rings"), py::arg("segments"), py::arg("half_length"))
 
         .def("gradient2d", Primitives::gradient2D, "2D square with a gradient", py::arg("a"), py::arg("color_a"), py::arg("b"), py::arg("color_b"))
         .def("gradient2d_horizontal", Primitives::gradient2DHorizontal, "2D square with a horizontal gradient", py::arg("color_left"), py::arg("color_right"))
@@ -133,10 +135,10 @@ void primitives(py::module& m) {
 
         .def("grid3d_solid", [](const Vector2i& subdivisions, Primitives::GridFlag flags) {
             return Primitives::grid3DSolid(subdivisions, flags);
-        }, "Solid 3D grid", py::arg("subdivisions"), py::arg("flags") = Primitives::GridFlag::GenerateNormals)
-        .def("grid3d_wireframe", Primitives::grid3DWireframe, "Wireframe 3D grid")
+        }, "Solid 3D grid", py::call_guard<py::gil_scoped_release>(), py::arg("subdivisions"), py::arg("flags") = Primitives::GridFlag::GenerateNormals)
+        .def("grid3d_wireframe", Primitives::grid3DWireframe, "Wireframe 3D grid", py::call_guard<py::gil_scoped_release>())
 
-        .def("icosphere_solid", Primitives::icosphereSolid, py::arg("subdivisions"))
+        .def("icosphere_solid", Primitives::icosphereSolid, "Solid 3D icosphere", py::call_guard<py::gil_scoped_release>(), py::arg("subdivisions"))
 
         .def("line2d", static_cast<Trade::MeshData2D(*)(const Vector2&, const Vector2&)>(Primitives::line2D), "2D line", py::arg("a"), py::arg("b"))
         .def("line2d", static_cast<Trade::MeshData2D(*)()>(Primitives::line2D), "2D line in an identity transformation")
@@ -149,8 +151,8 @@ void primitives(py::module& m) {
         .def("square_solid", Primitives::squareSolid, "Solid 2D square", py::arg("texture_coords") = Primitives::SquareTextureCoords::DontGenerate)
         .def("square_wireframe", Primitives::squareWireframe, "Wireframe 2D square")
 
-        .def("uv_sphere_solid", Primitives::uvSphereSolid, "Solid 3D UV sphere", py::arg("rings"), py::arg("segments"), py::arg("texture_coords") = Primitives::UVSphereTextureCoords::DontGenerate)
-        .def("uv_sphere_wireframe", Primitives::uvSphereWireframe, "Wireframe 3D UV sphere", py::arg("rings"), py::arg("segments"));
+        .def("uv_sphere_solid", Primitives::uvSphereSolid, "Solid 3D UV sphere", py::call_guard<py::gil_scoped_release>(), py::arg("rings"), py::arg("segments"), py::arg("texture_coords") = Primitives::UVSphereTextureCoords::DontGenerate)
+        .def("uv_sphere_wireframe", Primitives::uvSphereWireframe, "Wireframe 3D UV sphere", py::call_guard<py::gil_scoped_release>(), py::arg("rings"), py::arg("segments"));
 }
 
 }
@@ -0,0 +1,68 @@
+#
+#   This file is part of Magnum.
+#
+#   Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+#             Vladimír Vondruš <mosra@centrum.cz>
+#
+#   Permission is hereby granted, free of charge, to any person obtaining a
+#   copy of this software and associated documentation files (the "Software"),
+#   to deal in the Software without restriction, including without limitation
+#   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+#   and/or sell copies of the Software, and to permit persons to whom the
+#   Software is furnished to do so, subject to the following conditions:
+#
+#   The above copyright notice and this permission notice shall be included
+#   in all copies or substantial portions of the Software.
+#
+#   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+#   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+#   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+#   DEALINGS IN THE SOFTWARE.
+#
+
+# Avoid this being run implicitly during unit tests
+if __name__ != '__main__': exit()
+
+import subprocess
+import sys
+import timeit
+
+repeats = 20
+
+# Each import is done in a fresh interpreter as a module is imported only
+# once per process. The baseline is the interpreter startup itself.
+def timethat(code: str, *, title=None):
+    if not title: title = code
+
+    print('{:67} {:8.3f} ms'.format(title, timeit.timeit(lambda: subprocess.run([sys.executable, '-c', code], check=True), number=repeats)*1000.0/repeats))
+
+print("  interpreter startup and imports:\n")
+
+timethat('pass')
+timethat('import corrade')
+timethat('import magnum')
+timethat('import magnum.math')
+timethat('import magnum.trade')
+timethat('import magnum.gl')
+timethat('import magnum.shaders')
+timethat('import magnum.platform')
+timethat('import magnum.meshtools')
+
+# Importing every submodule up front is what `import magnum` used to do in
+# static builds before the submodules got initialized lazily, so it serves
+# as the baseline. Not all submodules are built everywhere, so the missing
+# ones are skipped.
+print("\n  all submodules up front (baseline) vs on demand:\n")
+
+timethat("""
+import importlib
+import magnum
+for i in ['gl', 'meshtools', 'platform', 'primitives', 'scenegraph', 'shaders', 'trade']:
+    try: importlib.import_module('magnum.' + i)
+    except ImportError: pass
+""", title='import magnum # eager, all submodules')
+timethat('import magnum', title='import magnum # lazy')
+timethat('import magnum; magnum.trade', title='import magnum; magnum.trade # lazy, one submodule')
@@ -26,6 +26,7 @@
 import sys
 import unittest
 
+from corrade import containers
 from magnum import *
 
 class PixelStorage_(unittest.TestCase):
@@ -63,14 +64,70 @@ class Image(unittest.TestCase):
         self.assertEqual(b.format, PixelFormat.R8I)
         self.assertEqual(len(b.data), 0)
 
-    @unittest.skip("No way to create a non-empty Image at the moment")
+    def test_init_array(self):
+        data = containers.Array(3*17*8)
+        data[5] = 'c'
+        a = Image2D(PixelFormat.RG32UI, Vector2i(3, 17), data)
+        self.assertEqual(a.size, Vector2i(3, 17))
+        self.assertEqual(a.format, PixelFormat.RG32UI)
+        self.assertEqual(len(a.data), 3*17*8)
+        self.assertEqual(a.data[5], 'c')
+
+        # The array got moved in, so it's empty now
+        self.assertEqual(len(data), 0)
+
+    def test_init_array_exported(self):
+        data = containers.Array(3*17*8)
+        view = memoryview(data)
+
+        with self.assertRaisesRegex(BufferError, "array data is exported to a buffer, can't move it"):
+            Image2D(PixelFormat.RG32UI, Vector2i(3, 17), data)
+
+        # Once the export is released, it can be moved
+        view.release()
+        a = Image2D(PixelFormat.RG32UI, Vector2i(3, 17), data)
+        self.assertEqual(len(a.data), 3*17*8)
+
+    def test_init_array_too_small(self):
+        data = containers.Array(3*17*8 - 1)
+
+        # The array isn't moved from on failure
+        with self.assertRaisesRegex(ValueError, "data too small, got 407 but expected at least 408 bytes"):
+            Image2D(PixelFormat.RG32UI, Vector2i(3, 17), data)
+        self.assertEqual(len(data), 3*17*8 - 1)
+
+        # Rows are padded to four bytes by default
+        with self.assertRaisesRegex(ValueError, "data too small, got 6 but expected at least 8 bytes"):
+            Image2D(PixelFormat.RGB8_UNORM, Vector2i(1, 2), containers.Array(6))
+        storage = PixelStorage()
+        storage.alignment = 1
+        a = Image2D(storage, PixelFormat.RGB8_UNORM, Vector2i(1, 2), containers.Array(6))
+        self.assertEqual(a.size, Vector2i(1, 2))
+
+    def test_init_array_viewed(self):
+        data = containers.Array(3*17*8)
+
+        # Slices and views reference the array through a buffer export as
+        # well, so they can't end up pointing to data owned by the image
+        sliced = data[8:16]
+        with self.assertRaisesRegex(BufferError, "array data is exported to a buffer, can't move it"):
+            Image2D(PixelFormat.RG32UI, Vector2i(3, 17), data)
+        del sliced
+
+        view = containers.StridedArrayView1D(data)
+        with self.assertRaisesRegex(BufferError, "array data is exported to a buffer, can't move it"):
+            Image2D(PixelFormat.RG32UI, Vector2i(3, 17), data)
+        del view
+
+        a = Image2D(PixelFormat.RG32UI, Vector2i(3, 17), data)
+        self.assertEqual(len(a.data), 3*17*8)
+
     def test_data(self):
-        # Tested in test_gl_gl.Framebuffer.test_read_image instead
-        a = Image2D(PixelFormat.R8I, Vector2i(3, 17)) # TODO
+        a = Image2D(PixelFormat.RG32UI, Vector2i(3, 17), containers.Array(3*17*8))
         a_refcount = sys.getrefcount(a)
 
         data = a.data
-        self.assertEqual(len(data), 3*17*1)
+        self.assertEqual(len(data), 3*17*8)
         self.assertIs(data.owner, a)
         self.assertEqual(sys.getrefcount(a), a_refcount + 1)
 
@@ -86,14 +143,12 @@ class Image(unittest.TestCase):
         self.assertIs(data.owner, None)
         self.assertEqual(sys.getrefcount(a), a_refcount)
 
-    @unittest.skip("No way to create a non-empty Image at the moment")
     def test_pixels(self):
-        # Tested in test_gl_gl.Framebuffer.test_read_image instead
-        a = Image2D(PixelFormat.RG32UI, Vector2i(3, 17)) # TODO
+        a = Image2D(PixelFormat.RG32UI, Vector2i(3, 17), containers.Array(3*17*8))
         a_refcount = sys.getrefcount(a)
 
         pixels = a.pixels
-        self.assertEqual(pixels.size, (3, 17, 8))
+        self.assertEqual(pixels.size, (17, 3, 8))
         self.assertIs(pixels.owner, a)
         self.assertEqual(sys.getrefcount(a), a_refcount + 1)
 
@@ -267,6 +267,26 @@ class Vector(unittest.TestCase):
         self.assertEqual(2.0*Vector2(1.0, -3.0), Vector2(2.0, -6.0))
         self.assertEqual(6.0/Vector2(2.0, -3.0), Vector2(3.0, -2.0))
 
+    def test_ops_mixed_types(self):
+        # Same types go through a fast path, everything else through the
+        # regular overloads
+        self.assertEqual(Vector3(1.0, 2.0, 3.0) + Vector3(0.5, 0.5, 0.5), Vector3(1.5, 2.5, 3.5))
+        self.assertEqual(Vector3(1.0, 2.0, 3.0) + (0.5, 0.5, 0.5), Vector3(1.5, 2.5, 3.5))
+        self.assertEqual(Vector4d(1.0, 2.0, 3.0, 4.0) - Vector4d(1.0, 1.0, 1.0, 1.0), Vector4d(0.0, 1.0, 2.0, 3.0))
+        self.assertEqual(Vector2(1.0, -3.0)*2.0, Vector2(2.0, -6.0))
+        self.assertEqual(Vector2(1.0, -3.0)*2, Vector2(2.0, -6.0))
+        self.assertEqual(2*Vector2(1.0, -3.0), Vector2(2.0, -6.0))
+
+        a = Vector3(1.0, 2.0, 3.0) + Color3(0.5, 0.5, 0.5)
+        self.assertIs(type(a), Vector3)
+        self.assertEqual(a, Vector3(1.5, 2.5, 3.5))
+        b = Color3(1.0, 2.0, 3.0)*Color3(0.5, 0.5, 0.5)
+        self.assertIs(type(b), Color3)
+        self.assertEqual(b, Color3(0.5, 1.0, 1.5))
+
+        with self.assertRaises(TypeError):
+            Vector3() + "hello"
+
     def test_swizzle(self):
         self.assertEqual(Vector3(3.0, 1.5, 0.4).yzxz, Vector4(1.5, 0.4, 3.0, 0.4))
         self.assertEqual(Vector3(3.0, 1.5, 0.4).gbrb, Vector4(1.5, 0.4, 3.0, 0.4))
@@ -338,6 +358,80 @@ class Vector(unittest.TestCase):
         a = memoryview(Vector4(1.0, 2.0, 3.0, 4.0))
         self.assertEqual(a.tolist(), [1.0, 2.0, 3.0, 4.0])
 
+class VectorArray(unittest.TestCase):
+    def test_init(self):
+        a = Vector3Array(3)
+        self.assertEqual(len(a), 3)
+        self.assertEqual(a[2], Vector3(0.0, 0.0, 0.0))
+
+        b = Vector2dArray(array.array('f', [1.0, 2.0, 3.0, 4.0]))
+        self.assertEqual(len(b), 2)
+        self.assertEqual(b[1], Vector2d(3.0, 4.0))
+
+    def test_init_invalid(self):
+        with self.assertRaisesRegex(BufferError, "expected a buffer of shape \\(n, 3\\)"):
+            Vector3Array(array.array('f', [1.0, 2.0, 3.0]))
+
+    def test_set_get(self):
+        a = Vector3Array(2)
+        a[1] = Vector3(1.0, 2.0, 3.0)
+        self.assertEqual(a[1], Vector3(1.0, 2.0, 3.0))
+        self.assertEqual(list(a), [Vector3(), Vector3(1.0, 2.0, 3.0)])
+
+        with self.assertRaises(IndexError):
+            a[2]
+        with self.assertRaises(IndexError):
+            a[2] = Vector3()
+
+    def test_ops(self):
+        a = Vector3Array(2)
+        a[0] = Vector3(1.0, 2.0, 3.0)
+        a[1] = Vector3(4.0, 5.0, 6.0)
+
+        self.assertEqual(list(a + a), [Vector3(2.0, 4.0, 6.0), Vector3(8.0, 10.0, 12.0)])
+        self.assertEqual(list(a - Vector3(1.0)), [Vector3(0.0, 1.0, 2.0), Vector3(3.0, 4.0, 5.0)])
+        self.assertEqual(list(a*2.0), [Vector3(2.0, 4.0, 6.0), Vector3(8.0, 10.0, 12.0)])
+        self.assertEqual(list(2.0*a), [Vector3(2.0, 4.0, 6.0), Vector3(8.0, 10.0, 12.0)])
+        self.assertEqual(list(a/a), [Vector3(1.0), Vector3(1.0)])
+        self.assertEqual(list(-a), [Vector3(-1.0, -2.0, -3.0), Vector3(-4.0, -5.0, -6.0)])
+
+        b = a
+        a += a
+        a *= 0.5
+        self.assertIs(a, b)
+        self.assertEqual(a[1], Vector3(4.0, 5.0, 6.0))
+
+        with self.assertRaisesRegex(ValueError, "expected arrays of the same size but got 2 and 3"):
+            a + Vector3Array(3)
+
+    def test_functions(self):
+        a = Vector3Array(2)
+        a[0] = Vector3(1.0, 2.0, 2.0)
+        a[1] = Vector3(0.0, 3.0, 4.0)
+
+        self.assertEqual(list(a.dot()), [9.0, 25.0])
+        self.assertEqual(list(a.length()), [3.0, 5.0])
+        self.assertEqual(list(math.dot(a, a)), [9.0, 25.0])
+        self.assertEqual(a.normalized()[1], Vector3(0.0, 0.6, 0.8))
+
+        b = Vector3Array(2)
+        b[0] = Vector3.x_axis()
+        b[1] = Vector3.x_axis()
+        self.assertEqual(math.cross(b, b)[0], Vector3())
+        self.assertEqual(math.cross(a, b)[1], Vector3(0.0, 4.0, -3.0))
+
+    def test_to_buffer(self):
+        a = Vector3Array(2)
+        a[1] = Vector3(1.0, 2.0, 3.0)
+        b = memoryview(a)
+        self.assertEqual(b.shape, (2, 3))
+        self.assertEqual(b.format, 'f')
+        self.assertEqual(b.tolist(), [[0.0, 0.0, 0.0], [1.0, 2.0, 3.0]])
+
+        # The memory is shared
+        b[0, 1] = 7.0
+        self.assertEqual(a[0], Vector3(0.0, 7.0, 0.0))
+
 class Color3_(unittest.TestCase):
     def test_init(self):
         a1 = Color3()
@@ -661,6 +755,12 @@ class Matrix(unittest.TestCase):
         self.assertEqual(a@b, c)
         self.assertEqual(a*Vector2(0.5, 0.25), Vector3(1.5, 2.25, 3.0))
 
+        d = Matrix3x3.from_diagonal((1.0, 2.0, 3.0))
+        self.assertEqual(c@d, Matrix3x3((9.0, 12.0, 15.0),
+                                        (38.0, 52.0, 66.0),
+                                        (87.0, 120.0, 153.0)))
+        self.assertEqual(c - c + d, d)
+
     def test_ops_number_on_the_left(self):
         a = Matrix2x3((1.0, 2.0, 3.0),
                       (4.0, 5.0, 6.0))
@@ -886,6 +986,49 @@ class Matrix4_(unittest.TestCase):
         self.assertEqual(Matrix4.scaling(Vector3(3.0)).inverted(),
                          Matrix4.scaling(Vector3(1/3.0)))
 
+    def test_transform_batch(self):
+        a = Vector3Array(2)
+        a[0] = Vector3(1.0, 2.0, 3.0)
+        a[1] = Vector3(-1.0, 0.0, 0.5)
+        m = Matrix4.translation((1.0, 0.0, 0.0))@Matrix4.scaling(Vector3(2.0))
+
+        points = m.transform_point(a)
+        self.assertIsInstance(points, Vector3Array)
+        self.assertEqual(list(points), [Vector3(3.0, 4.0, 6.0), Vector3(-1.0, 0.0, 1.0)])
+        self.assertEqual(list(m.transform_vector(a)), [Vector3(2.0, 4.0, 6.0), Vector3(-2.0, 0.0, 1.0)])
+
+        # In-place
+        out = m.transform_point(a, out=a)
+        self.assertIs(out, a)
+        self.assertEqual(a[1], Vector3(-1.0, 0.0, 1.0))
+
+        # In-place through a different view on the same memory
+        m.transform_vector(memoryview(a)[1:], out=memoryview(a)[1:])
+        self.assertEqual(a[1], Vector3(-2.0, 0.0, 2.0))
+
+        # One-dimensional buffers are still treated as a single vector
+        self.assertEqual(m.transform_point(array.array('d', [1.0, 2.0, 3.0])), Vector3(3.0, 4.0, 6.0))
+
+        # Homogeneous coordinates
+        b = Vector4Array(1)
+        b[0] = Vector4(1.0, 2.0, 3.0, 0.0)
+        self.assertEqual(m.transform_point(b)[0], Vector4(2.0, 4.0, 6.0, 0.0))
+
+    def test_transform_batch_invalid(self):
+        m = Matrix4()
+        with self.assertRaisesRegex(BufferError, "expected input to be a f buffer of shape \\(n, m\\) with contiguous rows"):
+            m.transform_point(Vector3dArray(2))
+        with self.assertRaisesRegex(BufferError, "expected input to have 3 or 4 columns but got 2"):
+            m.transform_point(Vector2Array(2))
+        with self.assertRaisesRegex(ValueError, "expected out to have shape \\(2, 3\\) but got \\(3, 3\\)"):
+            m.transform_point(Vector3Array(2), out=Vector3Array(3))
+        with self.assertRaisesRegex(BufferError, "expected input to be a f buffer of shape \\(n, m\\) with contiguous rows"):
+            m.transform_point(memoryview(Vector4Array(2)).cast('B').cast('f', (2, 2, 2)))
+
+        a = Vector3Array(3)
+        with self.assertRaisesRegex(ValueError, "out overlaps with input but isn't the same buffer"):
+            m.transform_point(memoryview(a)[:2], out=memoryview(a)[1:])
+
     def test_methods_return_type(self):
         self.assertIsInstance(Matrix4.identity_init(), Matrix4)
         self.assertIsInstance(Matrix4.from_diagonal((3.0, 1.5, 1.0, 1.0)), Matrix4)
@@ -952,6 +1095,44 @@ class Quaternion_(unittest.TestCase):
                        Quaterniond.rotation(Deg(75.0), Vector3d.x_axis()))
         self.assertEqual(Deg(a), Deg(15.0))
 
+    def test_functions_batch(self):
+        a = Quaternion.rotation(Deg(30.0), Vector3.x_axis())
+        b = Quaternion.rotation(Deg(90.0), Vector3.x_axis())
+        qa = Vector4Array(2)
+        qb = Vector4Array(2)
+        for i in range(2):
+            qa[i] = Vector4(*a.vector, a.scalar)
+            qb[i] = Vector4(*b.vector, b.scalar)
+
+        out = math.slerp(qa, qb, array.array('f', [0.0, 0.5]))
+        self.assertIsInstance(out, Vector4Array)
+        c = math.slerp(a, b, 0.5)
+        self.assertEqual(out[0], qa[0])
+        self.assertEqual(out[1], Vector4(*c.vector, c.scalar))
+
+        # Scalar factor, output into the input
+        self.assertIs(math.lerp(qa, qb, 0.5, out=qa), qa)
+        c = math.lerp(a, b, 0.5)
+        self.assertEqual(qa[1], Vector4(*c.vector, c.scalar))
+
+        qb *= 2.0
+        self.assertEqual(math.quaternions_normalized(qb)[0], Vector4(*b.vector, b.scalar))
+
+        matrices = math.quaternions_to_matrix(math.quaternions_normalized(qb))
+        self.assertEqual(Matrix3x3(matrices[1]), b.to_matrix())
+
+    def test_functions_batch_invalid(self):
+        with self.assertRaisesRegex(ValueError, "expected b to have shape \\(2, 4\\) but got \\(3, 4\\)"):
+            math.slerp(Vector4Array(2), Vector4Array(3), 0.5)
+        with self.assertRaisesRegex(ValueError, "expected t to have shape \\(2\\) but got \\(1, 1\\)"):
+            math.slerp(Vector4Array(2), Vector4Array(2), array.array('f', [0.5]))
+        with self.assertRaisesRegex(BufferError, "expected out to be a f buffer of shape \\(2, 3, 3\\) or \\(2, 4, 4\\)"):
+            math.quaternions_to_matrix(Vector4Array(2), out=Vector4Array(2))
+        # A (n, 2, 2) buffer has the right size but isn't a list of
+        # quaternions
+        with self.assertRaisesRegex(BufferError, "expected quaternions to be a f buffer of shape \\(n, m\\) with contiguous rows"):
+            math.quaternions_normalized(memoryview(Vector4Array(2)).cast('B').cast('f', (2, 2, 2)))
+
     def test_properties(self):
         a = Quaternion()
         a.vector = (1.0, 2.0, 3.0)
@@ -1038,3 +1219,44 @@ class Range(unittest.TestCase):
                       Range2D((0.3, 2.0), (0.4, 2.1)))
         self.assertEqual(a, Range2D((0.3, 0.7), (4.5, 5.7)))
         self.assertEqual(a.center(), Vector2(2.4, 3.2))
+
+    def test_batch(self):
+        points = Vector3Array(3)
+        points[0] = Vector3(1.0, 2.0, 3.0)
+        points[1] = Vector3(-1.0, 5.0, 0.5)
+        points[2] = Vector3(0.0, 0.0, 4.0)
+
+        a = Range3D.from_points(points)
+        self.assertEqual(a, Range3D((-1.0, 0.0, 0.5), (1.0, 5.0, 4.0)))
+
+        b = Range3D((0.0, 0.0, 0.0), (2.0, 3.0, 5.0))
+        self.assertEqual(list(b.contains(points)), [1, 0, 1])
+
+        # Two points are not confused with a range
+        self.assertEqual(len(b.contains(Vector3Array(2))), 2)
+
+        # One-dimensional buffers are still treated as a single point
+        self.assertIs(b.contains(array.array('d', [1.0, 1.0, 1.0])), True)
+
+        # Ranges are pairs of min and max, so a (n, 2, 3) buffer
+        ranges = Vector3Array(4)
+        ranges[0] = Vector3(1.0, 1.0, 1.0)
+        ranges[1] = Vector3(3.0, 3.0, 3.0)
+        ranges[2] = Vector3(5.0, 5.0, 5.0)
+        ranges[3] = Vector3(6.0, 6.0, 6.0)
+        self.assertEqual(list(math.intersects(b, memoryview(ranges).cast('B').cast('f', (2, 2, 3)))), [1, 0])
+
+    def test_batch_invalid(self):
+        with self.assertRaisesRegex(ValueError, "expected at least one point"):
+            Range3D.from_points(Vector3Array(0))
+        with self.assertRaisesRegex(BufferError, "expected points to have 2 columns but got 3"):
+            Range2D().contains(Vector3Array(1))
+        with self.assertRaisesRegex(BufferError, "expected b to have shape \\(n, 2, 3\\)"):
+            math.intersects(Range3D(), Vector3Array(2))
+        # Same size, but min and max on the last axis
+        with self.assertRaisesRegex(BufferError, "expected b to have shape \\(n, 2, 3\\)"):
+            math.intersects(Range3D(), memoryview(Vector3Array(4)).cast('B').cast('f', (2, 6)))
+        with self.assertRaisesRegex(BufferError, "expected b to have shape \\(n, 2, 3\\)"):
+            math.intersects(Range3D(), memoryview(Vector3Array(4)).cast('B').cast('f', (2, 3, 2)))
+        with self.assertRaisesRegex(BufferError, "expected out to be a one-dimensional bool or byte buffer of size 1"):
+            Range3D().contains(Vector3Array(1), out=bytearray(2))
@@ -105,6 +105,28 @@ class Vector(unittest.TestCase):
         with self.assertRaisesRegex(BufferError, "unexpected format d for a i vector"):
             b = Vector3i(a)
 
+class VectorArray(unittest.TestCase):
+    def test_from_numpy(self):
+        a = Vector3Array(np.array([[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]]))
+        self.assertEqual(list(a), [Vector3(1.0, 2.0, 3.0), Vector3(4.0, 5.0, 6.0)])
+
+    def test_from_numpy_byte_order(self):
+        # NumPy exports these with a '<' or '=' prefix in the format
+        a = Vector3Array(np.array([[1.0, 2.0, 3.0]], dtype='<f4'))
+        self.assertEqual(list(a), [Vector3(1.0, 2.0, 3.0)])
+        b = Vector3Array(np.array([[1.0, 2.0, 3.0]], dtype='=f8'))
+        self.assertEqual(list(b), [Vector3(1.0, 2.0, 3.0)])
+
+        with self.assertRaisesRegex(BufferError, "unexpected format >f for a f vector array"):
+            Vector3Array(np.array([[1.0, 2.0, 3.0]], dtype='>f4'))
+
+    def test_to_numpy(self):
+        a = Vector4dArray(2)
+        a[0] = Vector4d(1.0, 2.0, 3.0, 4.0)
+        b = np.array(a, copy=False)
+        self.assertEqual(b.dtype, np.float64)
+        np.testing.assert_array_equal(b, np.array([[1.0, 2.0, 3.0, 4.0], [0.0, 0.0, 0.0, 0.0]]))
+
 class Matrix(unittest.TestCase):
     def test_from_numpy(self):
         a = Matrix2x3(np.array(
@@ -318,7 +340,35 @@ class Matrix3_(unittest.TestCase):
              [4.0, 5.0, 6.0],
              [7.0, 8.0, 9.0]]))
 
+class Quaternion_(unittest.TestCase):
+    def test_functions_batch_numpy(self):
+        a = Quaterniond.rotation(Deg(90.0), Vector3d.z_axis())
+        q = np.array([[0.0, 0.0, 0.0, 1.0], [*a.vector, a.scalar]])
+        np.testing.assert_allclose(math.slerp(q[0:1], q[1:2], 1.0), q[1:2])
+
+        # Writing into a 4x4 output
+        out = np.zeros((2, 4, 4))
+        math.quaternions_to_matrix(q, out=out)
+        np.testing.assert_allclose(out[0], np.identity(4))
+        np.testing.assert_allclose(out[1], np.array(Matrix4d.rotation_z(Deg(90.0))), atol=1.0e-15)
+
 class Matrix4_(unittest.TestCase):
+    def test_transform_batch_numpy(self):
+        a = np.array([[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]], dtype='float32')
+        out = np.zeros((2, 3), dtype='float32')
+        m = Matrix4.translation((1.0, 2.0, 3.0))
+        self.assertIs(m.transform_point(a, out=out), out)
+        np.testing.assert_array_equal(out, np.array([[2.0, 4.0, 6.0], [5.0, 7.0, 9.0]]))
+
+        # Double matrices take double arrays
+        b = np.array(Matrix4d.scaling(Vector3d(2.0)).transform_vector(a.astype('d')), copy=False)
+        np.testing.assert_array_equal(b, np.array([[2.0, 4.0, 6.0], [8.0, 10.0, 12.0]]))
+
+        # A one-dimensional array is a single point, not a batch
+        c = m.transform_point(np.array([1.0, 2.0, 3.0]))
+        self.assertIsInstance(c, Vector3)
+        self.assertEqual(c, Vector3(2.0, 4.0, 6.0))
+
     def test_from_numpy(self):
         a = Matrix4(np.array(
             [[1.0, 2.0, 3.0, 4.0],
@@ -342,3 +392,19 @@ class Matrix4_(unittest.TestCase):
              [5.0, 6.0, 7.0, 8.0],
              [9.0, 10.0, 11.0, 12.0],
              [13.0, 14.0, 15.0, 16.0]]))
+
+class Range(unittest.TestCase):
+    def test_batch_numpy(self):
+        points = np.array([[0.5, 0.5], [2.0, 0.5], [0.0, 1.0]], dtype='float32')
+        self.assertEqual(Range2D.from_points(points), Range2D((0.0, 0.5), (2.0, 1.0)))
+
+        mask = np.zeros(3, dtype=bool)
+        a = Range2D((0.0, 0.0), (1.0, 1.0))
+        self.assertIs(a.contains(points, out=mask), mask)
+        np.testing.assert_array_equal(mask, [True, False, False])
+
+        ranges = np.array([[[0.5, 0.5], [3.0, 3.0]],
+                           [[2.0, 2.0], [3.0, 3.0]]])
+        np.testing.assert_array_equal(
+            np.frombuffer(math.intersects(Range2Dd(a), ranges), dtype=bool),
+            [True, False])
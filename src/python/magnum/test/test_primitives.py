@@ -23,6 +23,7 @@
 #   DEALINGS IN THE SOFTWARE.
 #
 
+import threading
 import unittest
 
 from magnum import *
@@ -282,3 +283,17 @@ class UVSphere(unittest.TestCase):
         a = primitives.uv_sphere_wireframe(6, 8)
         self.assertEqual(a.primitive, MeshPrimitive.LINES)
         self.assertTrue(a.is_indexed())
+
+class Threads(unittest.TestCase):
+    def test(self):
+        # The GIL is released during the generation, so these can run in
+        # parallel. The results should be the same as when generated serially.
+        expected = len(primitives.uv_sphere_solid(64, 64).indices)
+        counts = [None]*4
+        def generate(i):
+            counts[i] = len(primitives.uv_sphere_solid(64, 64).indices)
+
+        threads = [threading.Thread(target=generate, args=(i,)) for i in range(len(counts))]
+        for thread in threads: thread.start()
+        for thread in threads: thread.join()
+        self.assertEqual(counts, [expected]*len(counts))
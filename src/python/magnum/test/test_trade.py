@@ -23,11 +23,14 @@
 #   DEALINGS IN THE SOFTWARE.
 #
 
+import array
 import os
 import sys
+import tempfile
+import threading
 import unittest
 
-from corrade import pluginmanager
+from corrade import containers, pluginmanager
 from magnum import *
 from magnum import trade
 
@@ -46,6 +49,33 @@ class ImageData(unittest.TestCase):
         self.assertEqual(ord(image.pixels[1, 2, 2]), 181)
         self.assertEqual(ord(image.data[9 + 6 + 2]), 181) # libPNG has 12 +
 
+    def test_release(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), "rgb.png"))
+        image = importer.image2d(0)
+        storage = image.storage
+        pixels = image.pixels
+
+        data = image.release()
+        self.assertIsInstance(data, containers.Array)
+        self.assertEqual(len(data), 18)
+        self.assertEqual(ord(data[9 + 6 + 2]), 181)
+        self.assertEqual(image.size, Vector2i())
+        self.assertEqual(len(image.data), 0)
+
+        # Views created before are still valid
+        self.assertEqual(ord(pixels[1, 2, 2]), 181)
+
+        # Can't move the data while the image (and thus the views) is alive
+        with self.assertRaisesRegex(BufferError, "array data is exported to a buffer, can't move it"):
+            Image2D(storage, PixelFormat.RGB8_UNORM, Vector2i(3, 2), data)
+
+        del pixels
+        del image
+        moved = Image2D(storage, PixelFormat.RGB8_UNORM, Vector2i(3, 2), data)
+        self.assertEqual(moved.size, Vector2i(3, 2))
+        self.assertEqual(len(data), 0)
+
     def test_compressed(self):
         # The only way to get an image instance is through a manager
         importer = trade.ImporterManager().load_and_instantiate('DdsImporter')
@@ -96,7 +126,94 @@ class MeshData(unittest.TestCase):
 
         mesh = importer.mesh3d(0)
         self.assertEqual(mesh.primitive, MeshPrimitive.TRIANGLES)
-        # TODO: test more, once it's exposed
+        self.assertFalse(mesh.is_indexed())
+        self.assertEqual(mesh.position_array_count, 1)
+        self.assertEqual(mesh.normal_array_count, 0)
+        self.assertEqual(mesh.texture_coords2d_array_count, 0)
+        self.assertEqual(mesh.color_array_count, 0)
+
+    def test_attributes(self):
+        importer = trade.ImporterManager().load_and_instantiate('TinyGltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'mesh.glb'))
+        mesh = importer.mesh3d(1)
+        mesh_refcount = sys.getrefcount(mesh)
+
+        positions = mesh.positions()
+        self.assertIsInstance(positions, containers.MutableStridedArrayView2Df)
+        self.assertEqual(positions.size, (3, 3))
+        self.assertEqual(positions.stride, (12, 4))
+        self.assertIs(positions.owner, mesh)
+        self.assertEqual(sys.getrefcount(mesh), mesh_refcount + 1)
+        self.assertEqual(positions[0, 0], 1.5)
+        self.assertEqual(positions[1, 1], 2.5)
+        self.assertEqual(positions[2, 0], -2.0)
+
+        normals = mesh.normals()
+        self.assertEqual(normals.size, (3, 3))
+        self.assertAlmostEqual(normals[2, 2], 0.9)
+
+        indices = mesh.indices
+        self.assertIsInstance(indices, containers.MutableArrayViewui)
+        self.assertEqual(list(indices), [0, 1, 2])
+
+        # The views are mutable and operate on the mesh directly
+        positions[0, 0] = 3.0
+        self.assertEqual(mesh.positions()[0, 0], 3.0)
+
+        del positions, normals, indices
+        self.assertEqual(sys.getrefcount(mesh), mesh_refcount)
+
+    def test_init(self):
+        positions = memoryview(array.array('f', [
+            1.0, 2.0, 3.0,
+            4.0, 5.0, 6.0,
+            7.0, 8.0, 9.0]).tobytes()).cast('f', (3, 3))
+        indices = array.array('I', [2, 1, 0])
+
+        mesh = trade.MeshData3D(MeshPrimitive.TRIANGLES, positions, indices=indices)
+        self.assertEqual(mesh.primitive, MeshPrimitive.TRIANGLES)
+        self.assertTrue(mesh.is_indexed())
+        self.assertEqual(list(mesh.indices), [2, 1, 0])
+        self.assertEqual(mesh.position_array_count, 1)
+        self.assertEqual(mesh.normal_array_count, 0)
+        self.assertEqual(mesh.positions()[1, 2], 6.0)
+
+        # Non-contiguous input, such as a view on another mesh, works too
+        view = mesh.positions()
+        other = trade.MeshData3D(MeshPrimitive.POINTS, view[::2], normals=view[::2])
+        self.assertEqual(other.positions().size, (2, 3))
+        self.assertEqual(other.normals()[1, 0], 7.0)
+
+        mesh2d = trade.MeshData2D(MeshPrimitive.LINES, view[:2, :2], colors=memoryview(array.array('f', [0.0]*8).tobytes()).cast('f', (2, 4)))
+        self.assertEqual(mesh2d.positions()[1, 1], 5.0)
+        self.assertEqual(mesh2d.color_array_count, 1)
+        self.assertFalse(mesh2d.is_indexed())
+
+    def test_init_invalid(self):
+        positions = memoryview(array.array('f', [0.0]*6).tobytes()).cast('f', (3, 2))
+
+        with self.assertRaisesRegex(ValueError, "expected positions to be a float buffer of shape \\(n, 3\\)"):
+            trade.MeshData3D(MeshPrimitive.TRIANGLES, positions)
+        with self.assertRaisesRegex(ValueError, "expected 3 normals but got 2"):
+            trade.MeshData3D(MeshPrimitive.TRIANGLES, memoryview(array.array('f', [0.0]*9).tobytes()).cast('f', (3, 3)), normals=memoryview(array.array('f', [0.0]*6).tobytes()).cast('f', (2, 3)))
+        with self.assertRaisesRegex(ValueError, "expected indices to be a one-dimensional 32-bit unsigned integer buffer"):
+            trade.MeshData2D(MeshPrimitive.TRIANGLES, positions, indices=array.array('h', [0, 1, 2]))
+
+    def test_attributes_invalid(self):
+        importer = trade.ImporterManager().load_and_instantiate('TinyGltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'mesh.glb'))
+        mesh = importer.mesh3d(0)
+
+        with self.assertRaisesRegex(AttributeError, "mesh is not indexed"):
+            mesh.indices
+        with self.assertRaises(IndexError):
+            mesh.positions(1)
+        with self.assertRaises(IndexError):
+            mesh.normals(0)
+        with self.assertRaises(IndexError):
+            mesh.texture_coords2d(0)
+        with self.assertRaises(IndexError):
+            mesh.colors(0)
 
 class Importer(unittest.TestCase):
     def test(self):
@@ -233,6 +350,45 @@ class Importer(unittest.TestCase):
         del importer
         self.assertEqual(sys.getrefcount(manager), manager_refcount)
 
+    def test_image2d_bands(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'rgb.png'))
+        image = importer.image2d(0)
+
+        bands = importer.image2d_bands(0, rows=1)
+        self.assertIsInstance(bands, trade.ImageBands2DIterator)
+        bands = list(bands)
+        self.assertEqual(len(bands), 2)
+        for i, band in enumerate(bands):
+            self.assertIsInstance(band, ImageView2D)
+            self.assertEqual(band.size, Vector2i(3, 1))
+            self.assertEqual(band.format, image.format)
+            self.assertEqual(bytes(band.pixels[0]), bytes(image.pixels[i]))
+
+        # More rows than the image has gives back just one band
+        bands = list(importer.image2d_bands(0, rows=16))
+        self.assertEqual(len(bands), 1)
+        self.assertEqual(bands[0].size, Vector2i(3, 2))
+
+        # The bands keep the image alive even after the iterator is gone
+        band = next(importer.image2d_bands(0, rows=1))
+        self.assertEqual(bytes(band.pixels[0]), bytes(image.pixels[0]))
+
+    def test_image2d_bands_invalid(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'rgb.png'))
+
+        with self.assertRaisesRegex(ValueError, "row count has to be positive"):
+            importer.image2d_bands(0, rows=0)
+        with self.assertRaises(IndexError):
+            importer.image2d_bands(1, rows=1)
+
+        # Import failures are reported once the iteration starts
+        importer.open_data(b'bla')
+        bands = importer.image2d_bands(0, rows=1)
+        with self.assertRaisesRegex(RuntimeError, "import failed"):
+            next(bands)
+
     def test_image2d_data(self):
         importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
 
@@ -242,9 +398,403 @@ class Importer(unittest.TestCase):
         image = importer.image2d(0)
         self.assertEqual(image.size, Vector2i(3, 2))
 
+    def test_image2d_data_pin(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+
+        with open(os.path.join(os.path.dirname(__file__), "rgb.png"), 'rb') as f:
+            data = f.read()
+        data_refcount = sys.getrefcount(data)
+
+        # The data are referenced by the importer while it's opened
+        importer.open_data(data, pin=True)
+        self.assertEqual(sys.getrefcount(data), data_refcount + 1)
+
+        image = importer.image2d(0)
+        self.assertEqual(image.size, Vector2i(3, 2))
+
+        importer.close()
+        self.assertEqual(sys.getrefcount(data), data_refcount)
+
+        # Without pinning the data aren't referenced after the call
+        importer.open_data(data)
+        self.assertEqual(sys.getrefcount(data), data_refcount)
+
+    def test_image2d_threads(self):
+        # Each thread has its own importer, the GIL is released during the
+        # import so these can run in parallel
+        manager = trade.ImporterManager()
+        filename = os.path.join(os.path.dirname(__file__), 'rgb.png')
+        sizes = [None]*4
+        def work(i):
+            importer = manager.load_and_instantiate('StbImageImporter')
+            importer.open_file(filename)
+            sizes[i] = importer.image2d(0).size
+
+        threads = [threading.Thread(target=work, args=(i,)) for i in range(4)]
+        for thread in threads: thread.start()
+        for thread in threads: thread.join()
+        self.assertEqual(sizes, [Vector2i(3, 2)]*4)
+
+    def test_image2d_mmap(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'rgb.png'), mmap=True)
+        self.assertTrue(importer.is_opened)
+
+        image = importer.image2d(0)
+        self.assertEqual(image.size, Vector2i(3, 2))
+
+        # Opening a different file unmaps the previous one
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'rgb.png'))
+        self.assertEqual(importer.image2d(0).size, Vector2i(3, 2))
+
+        importer.close()
+        self.assertFalse(importer.is_opened)
+
+    def test_open_mmap_failed(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+
+        with self.assertRaisesRegex(RuntimeError, "opening nonexistent.png failed"):
+            importer.open_file('nonexistent.png', mmap=True)
+
+    def test_image2d_batch(self):
+        manager = trade.ImporterManager()
+        manager_refcount = sys.getrefcount(manager)
+        importer = manager.load_and_instantiate('StbImageImporter')
+
+        filename = os.path.join(os.path.dirname(__file__), 'rgb.png')
+        images = importer.image2d_batch([filename]*5, threads=3)
+        self.assertEqual(len(images), 5)
+        self.assertEqual([image.size for image in images], [Vector2i(3, 2)]*5)
+
+        # The worker instances are gone again, only the importer holds a
+        # reference to the manager
+        self.assertEqual(sys.getrefcount(manager), manager_refcount + 1)
+
+        # The importer itself doesn't have anything opened
+        self.assertFalse(importer.is_opened)
+
+    def test_image2d_batch_empty(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+        self.assertEqual(importer.image2d_batch([]), [])
+
+    def test_image2d_batch_failed(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+        filename = os.path.join(os.path.dirname(__file__), 'rgb.png')
+
+        with self.assertRaisesRegex(RuntimeError, "opening nonexistent.png failed"):
+            importer.image2d_batch([filename, 'nonexistent.png', filename])
+        with self.assertRaisesRegex(IndexError, "index 1 out of range in .*rgb.png"):
+            importer.image2d_batch([filename], id=1)
+
+    def test_mesh3d_batch(self):
+        importer = trade.ImporterManager().load_and_instantiate('TinyGltfImporter')
+        filename = os.path.join(os.path.dirname(__file__), 'mesh.glb')
+
+        meshes = importer.mesh3d_batch([filename]*3, id=1)
+        self.assertEqual(len(meshes), 3)
+        for mesh in meshes:
+            self.assertEqual(mesh.primitive, MeshPrimitive.TRIANGLES)
+
+    def test_images2d(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'rgb.png'))
+        importer_refcount = sys.getrefcount(importer)
+
+        # The iterator keeps the importer alive
+        images = importer.images2d(prefetch=1)
+        self.assertIsInstance(images, trade.ImageData2DIterator)
+        self.assertEqual(sys.getrefcount(importer), importer_refcount + 1)
+        self.assertEqual(len(images), 1)
+
+        self.assertEqual([image.size for image in images], [Vector2i(3, 2)])
+        self.assertEqual(len(images), 0)
+
+        del images
+        self.assertEqual(sys.getrefcount(importer), importer_refcount)
+
+    def test_meshes3d(self):
+        importer = trade.ImporterManager().load_and_instantiate('TinyGltfImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'mesh.glb'))
+
+        meshes = list(importer.meshes3d())
+        self.assertEqual(len(meshes), 3)
+        self.assertFalse(meshes[0].is_indexed())
+        self.assertTrue(meshes[1].is_indexed())
+
+        # Dropping the iterator early stops the worker
+        meshes = importer.meshes3d(prefetch=3)
+        self.assertEqual(next(meshes).primitive, MeshPrimitive.TRIANGLES)
+        del meshes
+
+    def test_images2d_busy(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'rgb.png'))
+        cache = trade.ImporterCache()
+
+        # The importer can't be used while the iterator is in progress
+        images = importer.images2d()
+        with self.assertRaisesRegex(RuntimeError, "importer is in use by an iterator"):
+            importer.image2d(0)
+        with self.assertRaisesRegex(RuntimeError, "importer is in use by an iterator"):
+            importer.images2d()
+        with self.assertRaisesRegex(RuntimeError, "importer is in use by an iterator"):
+            importer.close()
+        with self.assertRaisesRegex(RuntimeError, "importer is in use by an iterator"):
+            importer.open_file(os.path.join(os.path.dirname(__file__), 'rgb.png'))
+        with self.assertRaisesRegex(RuntimeError, "importer is in use by an iterator"):
+            cache.image2d(importer, os.path.join(os.path.dirname(__file__), 'rgb.png'), 0)
+
+        # Exhausting the iterator makes it usable again, even while the
+        # iterator itself is still alive
+        self.assertEqual(next(images).size, Vector2i(3, 2))
+        self.assertEqual(importer.image2d(0).size, Vector2i(3, 2))
+
+        # Same for destroying it early
+        images = importer.images2d()
+        del images
+        self.assertTrue(importer.is_opened)
+        importer.close()
+
+    def test_images2d_invalid(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+
+        with self.assertRaisesRegex(RuntimeError, "no file opened"):
+            importer.images2d()
+
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'rgb.png'))
+        with self.assertRaisesRegex(ValueError, "prefetch depth has to be at least one"):
+            importer.images2d(prefetch=0)
+
+    def test_images2d_failed(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+        importer.open_data(b'bla')
+
+        with self.assertRaisesRegex(RuntimeError, "import failed"):
+            next(importer.images2d())
+
     def test_image2d_failed(self):
         importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
         importer.open_data(b'bla')
 
         with self.assertRaisesRegex(RuntimeError, "import failed"):
             image = importer.image2d(0)
+
+class ImporterPool(unittest.TestCase):
+    def test(self):
+        manager = trade.ImporterManager()
+        manager_refcount = sys.getrefcount(manager)
+
+        pool = manager.pool('StbImageImporter', max_size=2)
+        self.assertIs(pool.manager, manager)
+        self.assertEqual(pool.plugin, 'StbImageImporter')
+        self.assertEqual(pool.max_size, 2)
+        self.assertEqual(len(pool), 0)
+        self.assertEqual(sys.getrefcount(manager), manager_refcount + 1)
+
+        a = pool.instantiate()
+        a.open_file(os.path.join(os.path.dirname(__file__), 'rgb.png'))
+        self.assertIs(a.manager, manager)
+        self.assertEqual(a.image2d(0).size, Vector2i(3, 2))
+        b = pool.instantiate()
+        c = pool.instantiate()
+        self.assertEqual(len(pool), 0)
+
+        # Released instances get back to the pool closed, up to the max size
+        del a, b, c
+        self.assertEqual(len(pool), 2)
+
+        d = pool.instantiate()
+        self.assertEqual(len(pool), 1)
+        self.assertFalse(d.is_opened)
+
+        # Instances outliving the pool are destroyed normally
+        del pool
+        del d
+        self.assertEqual(sys.getrefcount(manager), manager_refcount)
+
+    def test_threads(self):
+        pool = trade.ImporterManager().pool('StbImageImporter')
+        filename = os.path.join(os.path.dirname(__file__), 'rgb.png')
+        sizes = [None]*8
+        def work(i):
+            importer = pool.instantiate()
+            importer.open_file(filename)
+            sizes[i] = importer.image2d(0).size
+
+        threads = [threading.Thread(target=work, args=(i,)) for i in range(8)]
+        for thread in threads: thread.start()
+        for thread in threads: thread.join()
+        self.assertEqual(sizes, [Vector2i(3, 2)]*8)
+        self.assertLessEqual(len(pool), 4)
+
+    def test_load_failed(self):
+        with self.assertRaisesRegex(RuntimeError, "can't load plugin NonexistentImporter"):
+            trade.ImporterManager().pool('NonexistentImporter')
+
+class ImageConverter(unittest.TestCase):
+    def setUp(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+        importer.open_file(os.path.join(os.path.dirname(__file__), 'rgb.png'))
+        self.image = importer.image2d(0)
+
+    def test_export_to_data(self):
+        manager = trade.ImageConverterManager()
+        converter = manager.load_and_instantiate('TgaImageConverter')
+        self.assertIs(converter.manager, manager)
+
+        data = converter.export_to_data(self.image)
+        self.assertIsInstance(data, containers.Array)
+
+        importer = trade.ImporterManager().load_and_instantiate('TgaImporter')
+        importer.open_data(data)
+        image = importer.image2d(0)
+        self.assertEqual(image.size, Vector2i(3, 2))
+        self.assertEqual(bytes(image.pixels), bytes(self.image.pixels))
+
+    def test_export_to_file(self):
+        converter = trade.ImageConverterManager().load_and_instantiate('TgaImageConverter')
+
+        with tempfile.TemporaryDirectory() as tmp:
+            filename = os.path.join(tmp, 'image.tga')
+            converter.export_to_file(ImageView2D(self.image), filename)
+
+            importer = trade.ImporterManager().load_and_instantiate('TgaImporter')
+            importer.open_file(filename)
+            self.assertEqual(importer.image2d(0).size, Vector2i(3, 2))
+
+    def test_export_to_files(self):
+        converter = trade.ImageConverterManager().load_and_instantiate('TgaImageConverter')
+
+        with tempfile.TemporaryDirectory() as tmp:
+            filenames = [os.path.join(tmp, 'image{}.tga'.format(i)) for i in range(5)]
+            converter.export_to_files([self.image]*5, filenames, threads=2)
+
+            importer = trade.ImporterManager().load_and_instantiate('TgaImporter')
+            for filename in filenames:
+                importer.open_file(filename)
+                self.assertEqual(importer.image2d(0).size, Vector2i(3, 2))
+
+    def test_export_failed(self):
+        converter = trade.ImageConverterManager().load_and_instantiate('TgaImageConverter')
+
+        with self.assertRaisesRegex(RuntimeError, "exporting to nonexistent/image.tga failed"):
+            converter.export_to_file(self.image, 'nonexistent/image.tga')
+        with self.assertRaisesRegex(RuntimeError, "exporting to nonexistent/image.tga failed"):
+            converter.export_to_files([self.image], ['nonexistent/image.tga'])
+        with self.assertRaisesRegex(ValueError, "expected 1 filenames but got 2"):
+            converter.export_to_files([self.image], ['a.tga', 'b.tga'])
+
+class ImporterCache(unittest.TestCase):
+    def test_image2d(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+        filename = os.path.join(os.path.dirname(__file__), 'rgb.png')
+
+        cache = trade.ImporterCache()
+        self.assertEqual(cache.max_size, 64*1024*1024)
+        self.assertEqual(cache.directory, '')
+        self.assertEqual(len(cache), 0)
+        self.assertEqual(cache.size, 0)
+
+        a = cache.image2d(importer, filename)
+        self.assertEqual(a.size, Vector2i(3, 2))
+        self.assertEqual(len(cache), 1)
+        self.assertEqual(cache.size, len(a.data))
+
+        # Second lookup returns a copy of the cached data
+        b = cache.image2d(importer, filename)
+        self.assertIsNot(a, b)
+        self.assertEqual(b.size, Vector2i(3, 2))
+        self.assertEqual(bytes(a.data), bytes(b.data))
+        self.assertEqual(len(cache), 1)
+
+        # The importer itself isn't used for the import
+        self.assertFalse(importer.is_opened)
+
+        cache.clear()
+        self.assertEqual(len(cache), 0)
+        self.assertEqual(cache.size, 0)
+
+    def test_image2d_too_large(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+        filename = os.path.join(os.path.dirname(__file__), 'rgb.png')
+
+        cache = trade.ImporterCache(max_size=4)
+        self.assertEqual(cache.image2d(importer, filename).size, Vector2i(3, 2))
+        self.assertEqual(len(cache), 0)
+
+    def test_image2d_disk(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+        filename = os.path.join(os.path.dirname(__file__), 'rgb.png')
+
+        with tempfile.TemporaryDirectory() as tmp:
+            directory = os.path.join(tmp, 'cache')
+            a = trade.ImporterCache(directory=directory).image2d(importer, filename)
+            self.assertEqual(len(os.listdir(directory)), 1)
+
+            # A fresh cache picks the data from the disk
+            b = trade.ImporterCache(directory=directory).image2d(importer, filename)
+            self.assertEqual(b.size, Vector2i(3, 2))
+            self.assertEqual(b.format, a.format)
+            self.assertEqual(bytes(a.data), bytes(b.data))
+
+            # A truncated file is a cache miss and the file gets imported
+            # again
+            cached = os.path.join(directory, os.listdir(directory)[0])
+            with open(cached, 'r+b') as f:
+                f.truncate(os.path.getsize(cached) - 1)
+            c = trade.ImporterCache(directory=directory).image2d(importer, filename)
+            self.assertEqual(bytes(a.data), bytes(c.data))
+            self.assertEqual(os.listdir(directory), [os.path.basename(cached)])
+
+    def test_image2d_importer_opened(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+        filename = os.path.join(os.path.dirname(__file__), 'rgb.png')
+        importer.open_file(filename)
+
+        # A file opened in the importer stays opened
+        a = trade.ImporterCache().image2d(importer, filename)
+        self.assertEqual(a.size, Vector2i(3, 2))
+        self.assertTrue(importer.is_opened)
+        self.assertEqual(importer.image2d(0).size, Vector2i(3, 2))
+
+    def test_worker_reuse(self):
+        manager = trade.ImporterManager()
+        manager_refcount = sys.getrefcount(manager)
+        image_importer = manager.load_and_instantiate('StbImageImporter')
+        mesh_importer = manager.load_and_instantiate('TinyGltfImporter')
+        image_filename = os.path.join(os.path.dirname(__file__), 'rgb.png')
+        mesh_filename = os.path.join(os.path.dirname(__file__), 'mesh.glb')
+
+        # The instance decoding on a miss is kept around together with its
+        # manager, and replaced when a different plugin is used
+        cache = trade.ImporterCache()
+        self.assertEqual(cache.image2d(image_importer, image_filename).size, Vector2i(3, 2))
+        self.assertEqual(sys.getrefcount(manager), manager_refcount + 3)
+        cache.clear()
+        self.assertEqual(cache.image2d(image_importer, image_filename).size, Vector2i(3, 2))
+        self.assertEqual(cache.mesh3d(mesh_importer, mesh_filename, 1).primitive, MeshPrimitive.TRIANGLES)
+        self.assertEqual(cache.image2d(trade.ImporterManager().load_and_instantiate('StbImageImporter'), image_filename).size, Vector2i(3, 2))
+
+        del cache
+        self.assertEqual(sys.getrefcount(manager), manager_refcount + 2)
+
+    def test_mesh3d(self):
+        importer = trade.ImporterManager().load_and_instantiate('TinyGltfImporter')
+        filename = os.path.join(os.path.dirname(__file__), 'mesh.glb')
+
+        cache = trade.ImporterCache()
+        a = cache.mesh3d(importer, filename, 1)
+        b = cache.mesh3d(importer, filename, 1)
+        self.assertEqual(a.primitive, MeshPrimitive.TRIANGLES)
+        self.assertEqual(b.primitive, MeshPrimitive.TRIANGLES)
+        self.assertEqual(len(cache), 1)
+
+    def test_failed(self):
+        importer = trade.ImporterManager().load_and_instantiate('StbImageImporter')
+        cache = trade.ImporterCache()
+
+        with self.assertRaisesRegex(RuntimeError, "opening nonexistent.png failed"):
+            cache.image2d(importer, 'nonexistent.png')
+        with self.assertRaises(IndexError):
+            cache.image2d(importer, os.path.join(os.path.dirname(__file__), 'rgb.png'), 1)
+        self.assertEqual(len(cache), 0)
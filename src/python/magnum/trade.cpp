@@ -23,10 +23,31 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h> /* for *_batch() */
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/ScopeGuard.h>
 #include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Configuration.h>
+#include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/Sha1.h>
+#include <Magnum/PixelFormat.h>
+#include <Magnum/PixelStorage.h>
+#include <Magnum/Math/Color.h>
+#include <Magnum/Math/Functions.h>
 #include <Magnum/ImageView.h>
+#include <Magnum/Mesh.h>
+#include <Magnum/Trade/AbstractImageConverter.h>
 #include <Magnum/Trade/AbstractImporter.h>
 #include <Magnum/Trade/ImageData.h>
 #include <Magnum/Trade/MeshData2D.h>
@@ -35,6 +56,7 @@
 #include "Corrade/Containers/Python.h"
 #include "Magnum/Python.h"
 
+#include "corrade/PyBuffer.h"
 #include "corrade/pluginmanager.h"
 #include "magnum/bootstrap.h"
 
@@ -58,6 +80,21 @@ template<UnsignedInt dimensions, class T> PyObject* implicitlyConvertibleToImage
     return r;
 }
 
+/* Arrays coming from plugins with a custom deleter point to plugin code,
+   which could get unloaded while Python still holds the array. Those get
+   copied to a regular array, the others are passed through. */
+Containers::Array<char> withDefaultDeleter(Containers::Array<char>&& array) {
+    if(!array.deleter()) return std::move(array);
+
+    Containers::Array<char> out{Containers::NoInit, array.size()};
+    if(out.size()) std::memcpy(out.data(), array.data(), out.size());
+    return out;
+}
+
+void deleteArray(void* data) {
+    delete static_cast<Containers::Array<char>*>(data);
+}
+
 template<UnsignedInt dimensions> void imageData(py::class_<Trade::ImageData<dimensions>>& c) {
     /*
         Missing APIs:
@@ -134,21 +171,159 @@ template<UnsignedInt dimensions> void imageData(py::class_<Trade::ImageData<dime
             }
 
             return Containers::pyArrayViewHolder(self.pixels(), py::cast(self));
-        }, "View on pixel data");
+        }, "View on pixel data")
+
+        /* Other */
+        .def("release", [](py::object self) {
+            Containers::Array<char> released = py::cast<Trade::ImageData<dimensions>&>(self).release();
+
+            /* Data with a custom deleter get copied. Views created before
+               point to the original data, so those stay with the image. */
+            if(released.deleter()) {
+                py::object array = py::cast(withDefaultDeleter(std::move(released)));
+                py::detail::keep_alive_impl(self, py::capsule{new Containers::Array<char>{std::move(released)}, deleteArray});
+                return array;
+            }
+
+            /* Views created before keep the image alive, but not the array
+               the data moved to. Let the image hold a buffer export of the
+               array, so the array can't be freed or moved elsewhere while
+               the image (and thus any of these views) is still alive. */
+            py::object array = py::cast(std::move(released));
+            py::object exported = py::reinterpret_steal<py::object>(PyMemoryView_FromObject(array.ptr()));
+            if(!exported) throw py::error_already_set{};
+            py::detail::keep_alive_impl(self, exported);
+
+            return array;
+        }, "Release data storage");
+}
+
+/* View on an array of vectors or colors as a 2D float array, with the
+   second dimension being the components */
+template<class T> Containers::StridedArrayView2D<Float> componentView(std::vector<T>& data) {
+    return Containers::StridedArrayView2D<Float>{
+        Containers::arrayView(reinterpret_cast<Float*>(data.data()), data.size()*T::Size),
+        {data.size(), T::Size},
+        {std::ptrdiff_t(sizeof(T)), std::ptrdiff_t(sizeof(Float))}};
+}
+
+template<class T, class U, std::vector<U>&(T::*get)(UnsignedInt), UnsignedInt(T::*count)() const> Containers::PyArrayViewHolder<Containers::StridedArrayView2D<Float>> meshAttribute(T& self, UnsignedInt id) {
+    if(id >= (self.*count)()) {
+        PyErr_SetNone(PyExc_IndexError);
+        throw py::error_already_set{};
+    }
+
+    return Containers::pyArrayViewHolder(componentView((self.*get)(id)), py::cast(self));
+}
+
+bool isBufferFormat(const Py_buffer& buffer, char format, std::size_t size) {
+    return std::size_t(buffer.itemsize) == size && corrade::pyBufferFormatCharacter(buffer) == format;
+}
+
+/* Fills a vector from a buffer of shape (N, T::Size) and float items. A
+   single memcpy if the rows are contiguous and tightly packed, elementwise
+   copy otherwise. Empty vector for None. */
+template<class T> std::vector<T> vectorsFromBuffer(const py::object& obj, const char* name) {
+    if(obj.is_none()) return {};
+
+    /* GCC 4.8 otherwise loudly complains about missing initializers */
+    Py_buffer buffer{nullptr, nullptr, 0, 0, 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr};
+    if(PyObject_GetBuffer(obj.ptr(), &buffer, PyBUF_STRIDES|PyBUF_FORMAT) != 0)
+        throw py::error_already_set{};
+
+    Containers::ScopeGuard e{&buffer, PyBuffer_Release};
+
+    if(buffer.ndim != 2 || std::size_t(buffer.shape[1]) != T::Size || !isBufferFormat(buffer, 'f', sizeof(Float))) {
+        PyErr_Format(PyExc_ValueError, "expected %s to be a float buffer of shape (n, %zu)", name, std::size_t(T::Size));
+        throw py::error_already_set{};
+    }
+
+    std::vector<T> out(buffer.shape[0]);
+    const char* data = static_cast<const char*>(buffer.buf);
+    if(buffer.strides[0] == sizeof(T) && buffer.strides[1] == sizeof(Float)) {
+        if(!out.empty()) std::memcpy(out.data(), data, out.size()*sizeof(T));
+    } else for(std::size_t i = 0; i != out.size(); ++i)
+        for(std::size_t j = 0; j != T::Size; ++j)
+            out[i][j] = *reinterpret_cast<const Float*>(data + i*buffer.strides[0] + j*buffer.strides[1]);
+
+    return out;
 }
 
-template<class T> void meshData(py::class_<T>& c) {
+std::vector<UnsignedInt> indicesFromBuffer(const py::object& obj) {
+    if(obj.is_none()) return {};
+
+    /* GCC 4.8 otherwise loudly complains about missing initializers */
+    Py_buffer buffer{nullptr, nullptr, 0, 0, 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr};
+    if(PyObject_GetBuffer(obj.ptr(), &buffer, PyBUF_STRIDES|PyBUF_FORMAT) != 0)
+        throw py::error_already_set{};
+
+    Containers::ScopeGuard e{&buffer, PyBuffer_Release};
+
+    if(buffer.ndim != 1 || !isBufferFormat(buffer, 'I', sizeof(UnsignedInt))) {
+        PyErr_SetString(PyExc_ValueError, "expected indices to be a one-dimensional 32-bit unsigned integer buffer");
+        throw py::error_already_set{};
+    }
+
+    std::vector<UnsignedInt> out(buffer.shape[0]);
+    const char* data = static_cast<const char*>(buffer.buf);
+    if(buffer.strides[0] == sizeof(UnsignedInt)) {
+        if(!out.empty()) std::memcpy(out.data(), data, out.size()*sizeof(UnsignedInt));
+    } else for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = *reinterpret_cast<const UnsignedInt*>(data + i*buffer.strides[0]);
+
+    return out;
+}
+
+/* Wraps a non-empty attribute vector in a one-item array list */
+template<class T> std::vector<std::vector<T>> attributeArrays(std::vector<T>&& data, std::size_t vertexCount, const char* name) {
+    if(data.empty()) return {};
+    if(data.size() != vertexCount) {
+        PyErr_Format(PyExc_ValueError, "expected %zu %s but got %zu", vertexCount, name, data.size());
+        throw py::error_already_set{};
+    }
+
+    std::vector<std::vector<T>> out;
+    out.push_back(std::move(data));
+    return out;
+}
+
+template<class T, class Position> void meshData(py::class_<T>& c) {
     c
         .def_property_readonly("primitive", &T::primitive, "Primitive")
         .def("is_indexed", &T::isIndexed, "Whether the mesh is indexed")
         .def("has_texture_coords2d", &T::hasTextureCoords2D, "Whether the data contain any 2D texture coordinates")
-        .def("has_colors", &T::hasColors, "Whether the data contain any vertex colors");
+        .def("has_colors", &T::hasColors, "Whether the data contain any vertex colors")
+        .def_property_readonly("position_array_count", &T::positionArrayCount, "Count of position arrays")
+        .def_property_readonly("texture_coords2d_array_count", &T::textureCoords2DArrayCount, "Count of 2D texture coordinate arrays")
+        .def_property_readonly("color_array_count", &T::colorArrayCount, "Count of color arrays")
+        .def_property_readonly("indices", [](T& self) {
+            if(!self.isIndexed()) {
+                PyErr_SetString(PyExc_AttributeError, "mesh is not indexed");
+                throw py::error_already_set{};
+            }
+
+            return Containers::pyArrayViewHolder(Containers::ArrayView<UnsignedInt>{self.indices().data(), self.indices().size()}, py::cast(self));
+        }, "Indices")
+        .def("positions", meshAttribute<T, Position, &T::positions, &T::positionArrayCount>, "Positions", py::arg("id") = 0)
+        .def("texture_coords2d", meshAttribute<T, Vector2, &T::textureCoords2D, &T::textureCoords2DArrayCount>, "2D texture coordinates", py::arg("id") = 0)
+        .def("colors", meshAttribute<T, Color4, &T::colors, &T::colorArrayCount>, "Vertex colors", py::arg("id") = 0);
+}
+
+/* The importer isn't thread-safe, so it can't be used while an iterator
+   decodes data from it on a worker thread */
+void checkNotBusy(Trade::AbstractImporter& self) {
+    if(pyObjectHolderFor<PluginManager::PyPluginHolder>(self).busy) {
+        PyErr_SetString(PyExc_RuntimeError, "importer is in use by an iterator");
+        throw py::error_already_set{};
+    }
 }
 
 /* For some reason having ...Args as the second (and not last) template
    argument does not work. So I'm listing all variants here ... which are
    exactly two, in fact. */
 template<class R, R(Trade::AbstractImporter::*f)() const> R checkOpened(Trade::AbstractImporter& self) {
+    checkNotBusy(self);
+
     if(!self.isOpened()) {
         PyErr_SetString(PyExc_RuntimeError, "no file opened");
         throw py::error_already_set{};
@@ -156,6 +331,8 @@ template<class R, R(Trade::AbstractImporter::*f)() const> R checkOpened(Trade::A
     return (self.*f)();
 }
 template<class R, class Arg1, R(Trade::AbstractImporter::*f)(Arg1)> R checkOpened(Trade::AbstractImporter& self, Arg1 arg1) {
+    checkNotBusy(self);
+
     if(!self.isOpened()) {
         PyErr_SetString(PyExc_RuntimeError, "no file opened");
         throw py::error_already_set{};
@@ -164,6 +341,8 @@ template<class R, class Arg1, R(Trade::AbstractImporter::*f)(Arg1)> R checkOpene
 }
 
 template<class R, R(Trade::AbstractImporter::*f)(UnsignedInt), UnsignedInt(Trade::AbstractImporter::*bounds)() const> R checkOpenedBounds(Trade::AbstractImporter& self, UnsignedInt id) {
+    checkNotBusy(self);
+
     if(!self.isOpened()) {
         PyErr_SetString(PyExc_RuntimeError, "no file opened");
         throw py::error_already_set{};
@@ -178,6 +357,8 @@ template<class R, R(Trade::AbstractImporter::*f)(UnsignedInt), UnsignedInt(Trade
 }
 
 template<class R, Containers::Optional<R>(Trade::AbstractImporter::*f)(UnsignedInt), UnsignedInt(Trade::AbstractImporter::*bounds)() const> R checkOpenedBoundsResult(Trade::AbstractImporter& self, UnsignedInt id) {
+    checkNotBusy(self);
+
     if(!self.isOpened()) {
         PyErr_SetString(PyExc_RuntimeError, "no file opened");
         throw py::error_already_set{};
@@ -190,7 +371,14 @@ template<class R, Containers::Optional<R>(Trade::AbstractImporter::*f)(UnsignedI
 
     /** @todo log redirection -- but we'd need assertions to not be part of
         that so when it dies, the user can still see why */
-    Containers::Optional<R> out = (self.*f)(id);
+    Containers::Optional<R> out;
+    {
+        /* The import can take a while, let other threads run meanwhile. The
+           importer itself is not thread-safe, so it's up to the user to not
+           use the same instance from more threads at once. */
+        py::gil_scoped_release release;
+        out = (self.*f)(id);
+    }
     if(!out) {
         PyErr_SetString(PyExc_RuntimeError, "import failed");
         throw py::error_already_set{};
@@ -199,6 +387,617 @@ template<class R, Containers::Optional<R>(Trade::AbstractImporter::*f)(UnsignedI
     return *std::move(out);
 }
 
+#if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+typedef Containers::Array<const char, Utility::Directory::MapDeleter> MappedFile;
+
+void deleteMappedFile(void* data) {
+    delete static_cast<MappedFile*>(data);
+}
+#endif
+
+/* Creates one instance of the same plugin for each worker thread of a batch
+   operation. The instances are created and destroyed with the GIL held as the
+   manager isn't thread-safe. Zero thread count means as many threads as there
+   are cores, but never more than there are items. The calling thread is
+   meant to be one of the workers. */
+template<class T> std::vector<std::unique_ptr<T>> batchWorkers(T& self, std::size_t itemCount, std::size_t threadCount) {
+    auto& manager = py::cast<PluginManager::Manager<T>&>(pyObjectHolderFor<PluginManager::PyPluginHolder>(self).manager);
+
+    if(!threadCount) threadCount = std::thread::hardware_concurrency();
+    if(threadCount > itemCount) threadCount = itemCount;
+    if(!threadCount) threadCount = 1;
+
+    std::vector<std::unique_ptr<T>> workers;
+    for(std::size_t i = 0; i != threadCount; ++i) {
+        auto worker = manager.instantiate(self.plugin());
+        if(!worker) {
+            PyErr_Format(PyExc_RuntimeError, "can't instantiate plugin %s", self.plugin().data());
+            throw py::error_already_set{};
+        }
+        workers.emplace_back(worker.release());
+    }
+
+    return workers;
+}
+
+/* Importers are given back to a pool closed */
+void closeImporter(Trade::AbstractImporter& importer) {
+    importer.close();
+}
+
+enum class BatchStatus: UnsignedByte {
+    Success,
+    OpenFailed,
+    OutOfBounds,
+    ImportFailed
+};
+
+/* Imports data of given ID from a batch of files in parallel. Each worker
+   thread gets its own instance of the same plugin, the import itself runs
+   without the GIL. */
+template<class R, Containers::Optional<R>(Trade::AbstractImporter::*f)(UnsignedInt), UnsignedInt(Trade::AbstractImporter::*bounds)() const> py::list checkBatchResult(Trade::AbstractImporter& self, const std::vector<std::string>& filenames, UnsignedInt id, UnsignedInt threadCount) {
+    std::vector<std::unique_ptr<Trade::AbstractImporter>> importers = batchWorkers(self, filenames.size(), threadCount);
+
+    /* Each item is written by exactly one worker, so no locking needed */
+    std::vector<Containers::Optional<R>> results(filenames.size());
+    std::vector<BatchStatus> status(filenames.size(), BatchStatus::Success);
+    std::atomic<std::size_t> next{0};
+    auto work = [&](Trade::AbstractImporter& importer) {
+        for(std::size_t i; (i = next++) < filenames.size(); ) {
+            /** @todo log redirection, same as in the single-item variants */
+            if(!importer.openFile(filenames[i])) {
+                status[i] = BatchStatus::OpenFailed;
+                continue;
+            }
+
+            if(id >= (importer.*bounds)())
+                status[i] = BatchStatus::OutOfBounds;
+            else if(!(results[i] = (importer.*f)(id)))
+                status[i] = BatchStatus::ImportFailed;
+
+            importer.close();
+        }
+    };
+    {
+        py::gil_scoped_release release;
+        std::vector<std::thread> threads;
+        for(std::size_t i = 1; i < importers.size(); ++i)
+            threads.emplace_back(work, std::ref(*importers[i]));
+        work(*importers[0]);
+        for(std::thread& thread: threads) thread.join();
+    }
+
+    /* Report the first failure, if any */
+    for(std::size_t i = 0; i != filenames.size(); ++i) {
+        if(status[i] == BatchStatus::OpenFailed) {
+            PyErr_Format(PyExc_RuntimeError, "opening %s failed", filenames[i].data());
+            throw py::error_already_set{};
+        }
+        if(status[i] == BatchStatus::OutOfBounds) {
+            PyErr_Format(PyExc_IndexError, "index %u out of range in %s", id, filenames[i].data());
+            throw py::error_already_set{};
+        }
+        if(status[i] == BatchStatus::ImportFailed) {
+            PyErr_Format(PyExc_RuntimeError, "import from %s failed", filenames[i].data());
+            throw py::error_already_set{};
+        }
+    }
+
+    py::list out;
+    for(Containers::Optional<R>& result: results)
+        out.append(py::cast(*std::move(result)));
+    return out;
+}
+
+/* Iterates over all data of given type in an importer, decoding up to
+   `depth` items ahead on a worker thread. Until all items are consumed or
+   the iterator is destroyed, the importer is marked as busy and all other
+   entry points refuse to use it. */
+template<class R, Containers::Optional<R>(Trade::AbstractImporter::*f)(UnsignedInt)> struct ImporterIterator {
+    explicit ImporterIterator(Trade::AbstractImporter& importer, py::object importerObject, UnsignedInt count, std::size_t depth): importer(importer), importerObject{std::move(importerObject)}, count{count}, depth{depth}, worker{&ImporterIterator::run, this} {
+        pyObjectHolderFor<PluginManager::PyPluginHolder>(importer).busy = count != 0;
+    }
+
+    ~ImporterIterator() {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            stop = true;
+        }
+        condition.notify_all();
+        worker.join();
+
+        /* Destructed by pybind, so with the GIL held */
+        if(consumed != count)
+            pyObjectHolderFor<PluginManager::PyPluginHolder>(importer).busy = false;
+    }
+
+    void run() {
+        for(UnsignedInt id = 0; id != count; ++id) {
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                condition.wait(lock, [&]{ return stop || queue.size() < depth; });
+                if(stop) return;
+            }
+
+            /** @todo log redirection, same as in the single-item variants */
+            Containers::Optional<R> result = (importer.*f)(id);
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                queue.push_back(std::move(result));
+            }
+            condition.notify_all();
+        }
+    }
+
+    R next() {
+        if(consumed == count) throw py::stop_iteration{};
+
+        Containers::Optional<R> result;
+        {
+            /* The lock gets released before the GIL is acquired again */
+            py::gil_scoped_release release;
+            std::unique_lock<std::mutex> lock{mutex};
+            condition.wait(lock, [&]{ return !queue.empty(); });
+            result = std::move(queue.front());
+            queue.pop_front();
+        }
+        condition.notify_all();
+
+        /* The worker doesn't touch the importer after producing the last
+           item, so it can be used again right away */
+        if(++consumed == count)
+            pyObjectHolderFor<PluginManager::PyPluginHolder>(importer).busy = false;
+
+        if(!result) {
+            PyErr_SetString(PyExc_RuntimeError, "import failed");
+            throw py::error_already_set{};
+        }
+
+        return *std::move(result);
+    }
+
+    Trade::AbstractImporter& importer;
+    py::object importerObject;
+    const UnsignedInt count;
+    const std::size_t depth;
+    UnsignedInt consumed{};
+    bool stop{};
+    std::deque<Containers::Optional<R>> queue;
+    std::mutex mutex;
+    std::condition_variable condition;
+    /* Has to be last so everything above is initialized when it starts */
+    std::thread worker;
+};
+
+template<class R, Containers::Optional<R>(Trade::AbstractImporter::*f)(UnsignedInt), UnsignedInt(Trade::AbstractImporter::*bounds)() const> ImporterIterator<R, f>* importerIterator(Trade::AbstractImporter& self, std::size_t prefetch) {
+    checkNotBusy(self);
+
+    if(!self.isOpened()) {
+        PyErr_SetString(PyExc_RuntimeError, "no file opened");
+        throw py::error_already_set{};
+    }
+
+    if(!prefetch) {
+        PyErr_SetString(PyExc_ValueError, "prefetch depth has to be at least one");
+        throw py::error_already_set{};
+    }
+
+    return new ImporterIterator<R, f>{self, py::cast(self), (self.*bounds)(), prefetch};
+}
+
+template<class R, Containers::Optional<R>(Trade::AbstractImporter::*f)(UnsignedInt)> void importerIteratorClass(py::module& m, const char* name, const char* doc) {
+    py::class_<ImporterIterator<R, f>>{m, name, doc}
+        .def("__iter__", [](py::object self) { return self; }, "Iterator")
+        .def("__next__", &ImporterIterator<R, f>::next, "Next item")
+        .def("__len__", [](ImporterIterator<R, f>& self) {
+            return self.count - self.consumed;
+        }, "Count of remaining items");
+}
+
+void exportToFilesBatch(Trade::AbstractImageConverter& self, const std::vector<ImageView2D>& images, const std::vector<std::string>& filenames, UnsignedInt threadCount) {
+    if(images.size() != filenames.size()) {
+        PyErr_Format(PyExc_ValueError, "expected %zu filenames but got %zu", images.size(), filenames.size());
+        throw py::error_already_set{};
+    }
+
+    std::vector<std::unique_ptr<Trade::AbstractImageConverter>> converters = batchWorkers(self, images.size(), threadCount);
+
+    /* Each item is written by exactly one worker, so no locking needed */
+    std::vector<char> exported(images.size(), false);
+    std::atomic<std::size_t> next{0};
+    auto work = [&](Trade::AbstractImageConverter& converter) {
+        for(std::size_t i; (i = next++) < images.size(); )
+            /** @todo log redirection, same as in the single-item variants */
+            exported[i] = converter.exportToFile(images[i], filenames[i]);
+    };
+    {
+        py::gil_scoped_release release;
+        std::vector<std::thread> threads;
+        for(std::size_t i = 1; i < converters.size(); ++i)
+            threads.emplace_back(work, std::ref(*converters[i]));
+        work(*converters[0]);
+        for(std::thread& thread: threads) thread.join();
+    }
+
+    /* Report the first failure, if any */
+    for(std::size_t i = 0; i != images.size(); ++i) if(!exported[i]) {
+        PyErr_Format(PyExc_RuntimeError, "exporting to %s failed", filenames[i].data());
+        throw py::error_already_set{};
+    }
+}
+
+/* Iterates over an imported image in bands of given row count. The importer
+   interface has no incremental decoding, so the image is decoded whole on
+   the first next() and the bands are views on it, all sharing the image
+   data as their owner. The iterator drops its reference to the image once
+   exhausted. */
+struct ImageBands2DIterator {
+    explicit ImageBands2DIterator(py::object importer, UnsignedInt id, Int rows): importer{std::move(importer)}, id{id}, rows{rows} {}
+
+    py::object next() {
+        if(done) throw py::stop_iteration{};
+
+        if(image.is_none()) {
+            py::object decoded = py::cast(checkOpenedBoundsResult<Trade::ImageData2D, &Trade::AbstractImporter::image2D, &Trade::AbstractImporter::image2DCount>(py::cast<Trade::AbstractImporter&>(importer), id));
+            if(py::cast<const Trade::ImageData2D&>(decoded).isCompressed()) {
+                PyErr_SetString(PyExc_RuntimeError, "image is compressed");
+                throw py::error_already_set{};
+            }
+            image = std::move(decoded);
+        }
+
+        const Trade::ImageData2D& data = py::cast<const Trade::ImageData2D&>(image);
+        if(y >= data.size().y()) {
+            done = true;
+            image = py::none{};
+            throw py::stop_iteration{};
+        }
+
+        /* Skip of whole rows is baked into the data pointer of each band,
+           only the X skip stays in the storage */
+        const auto properties = data.dataProperties();
+        const std::size_t start = properties.first.y();
+        const std::size_t rowStride = properties.second.x();
+        PixelStorage storage = data.storage();
+        storage.setSkip({storage.skip().x(), 0, 0});
+
+        const Int height = Math::min(rows, data.size().y() - y);
+        py::object band = pyCastButNotShitty(pyImageViewHolder(ImageView2D{storage,
+            data.format(), data.formatExtra(), data.pixelSize(),
+            {data.size().x(), height},
+            data.data().slice(start + y*rowStride, start + (y + height)*rowStride)}, image));
+        y += height;
+        return band;
+    }
+
+    py::object importer;
+    const UnsignedInt id;
+    const Int rows;
+    py::object image;
+    Int y{};
+    bool done{};
+};
+
+ImageBands2DIterator* imageBands2D(Trade::AbstractImporter& self, UnsignedInt id, Int rows) {
+    checkNotBusy(self);
+
+    if(rows <= 0) {
+        PyErr_SetString(PyExc_ValueError, "row count has to be positive");
+        throw py::error_already_set{};
+    }
+
+    /* Report a missing file or an out-of-range ID right away, not only once
+       the iteration starts */
+    if(!self.isOpened()) {
+        PyErr_SetString(PyExc_RuntimeError, "no file opened");
+        throw py::error_already_set{};
+    }
+    if(id >= self.image2DCount()) {
+        PyErr_SetNone(PyExc_IndexError);
+        throw py::error_already_set{};
+    }
+
+    return new ImageBands2DIterator{py::cast(self), id, rows};
+}
+
+/* LRU cache of decoded importer data, keyed by SHA-1 of the file contents,
+   plugin name, importer configuration and data ID. The data are stored as
+   Python objects and each lookup returns a copy, so the cached instance
+   can't be modified from outside. All access happens with the GIL held. */
+struct ImporterCache {
+    struct Entry {
+        std::string key;
+        std::size_t size;
+        py::object data;
+    };
+
+    explicit ImporterCache(std::size_t maxSize, std::string directory): maxSize{maxSize}, directory{std::move(directory)} {}
+
+    py::object* find(const std::string& key) {
+        auto found = index.find(key);
+        if(found == index.end()) return nullptr;
+
+        /* Mark as most recently used. Splicing doesn't invalidate the
+           iterator stored in the index. */
+        entries.splice(entries.begin(), entries, found->second);
+        return &found->second->data;
+    }
+
+    void insert(const std::string& key, std::size_t size, py::object data) {
+        /* Things that wouldn't fit even into an empty cache are not cached
+           at all */
+        if(size > maxSize || index.find(key) != index.end()) return;
+
+        entries.push_front(Entry{key, size, std::move(data)});
+        index.emplace(key, entries.begin());
+        currentSize += size;
+
+        /* Evict least recently used entries until it fits */
+        while(currentSize > maxSize) {
+            currentSize -= entries.back().size;
+            index.erase(entries.back().key);
+            entries.pop_back();
+        }
+    }
+
+    void clear() {
+        index.clear();
+        entries.clear();
+        currentSize = 0;
+    }
+
+    std::size_t maxSize, currentSize{};
+    std::string directory;
+    std::list<Entry> entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+
+    /* Importer decoding the data on a cache miss, reused for as long as the
+       lookups are done with the same plugin from the same manager. The
+       manager is declared first so it outlives the instance. */
+    py::object workerManager;
+    std::unique_ptr<Trade::AbstractImporter> worker;
+};
+
+/* Header of an image stored in the on-disk cache tier, followed by the pixel
+   data */
+struct ImporterCacheImageHeader {
+    char magic[4];
+    UnsignedInt dimensions, format, formatExtra, pixelSize, alignment;
+    Int rowLength, imageHeight;
+    Vector3i skip, size;
+};
+
+template<class> struct ImporterCacheTraits;
+template<UnsignedInt dimensions> struct ImporterCacheTraits<Trade::ImageData<dimensions>> {
+    static std::size_t size(const Trade::ImageData<dimensions>& image) {
+        return image.data().size();
+    }
+
+    static Trade::ImageData<dimensions> copy(const Trade::ImageData<dimensions>& image) {
+        Containers::Array<char> data{Containers::NoInit, image.data().size()};
+        if(data.size()) std::memcpy(data.data(), image.data().data(), data.size());
+        if(image.isCompressed())
+            return Trade::ImageData<dimensions>{image.compressedStorage(), image.compressedFormat(), image.size(), std::move(data)};
+        return Trade::ImageData<dimensions>{image.storage(), image.format(), image.formatExtra(), image.pixelSize(), image.size(), std::move(data)};
+    }
+
+    /* Only uncompressed images are stored on disk, the cache is best-effort
+       so write failures are ignored. The file is written under a temporary
+       name and then renamed, so other processes sharing the directory never
+       see a partially written file. */
+    static void save(const std::string& filename, const Trade::ImageData<dimensions>& image) {
+        if(image.isCompressed()) return;
+
+        const ImporterCacheImageHeader header{{'M', 'I', 'C', '1'},
+            dimensions, UnsignedInt(image.format()), image.formatExtra(),
+            image.pixelSize(), UnsignedInt(image.storage().alignment()),
+            image.storage().rowLength(), image.storage().imageHeight(),
+            image.storage().skip(), Vector3i::pad(image.size(), 1)};
+        Containers::Array<char> out{Containers::NoInit, sizeof(header) + image.data().size()};
+        std::memcpy(out.data(), &header, sizeof(header));
+        if(image.data().size()) std::memcpy(out.data() + sizeof(header), image.data().data(), image.data().size());
+        const std::string temporary = filename + '.' + std::to_string(std::random_device{}()) + ".tmp";
+        if(!Utility::Directory::write(temporary, out) || !Utility::Directory::move(temporary, filename))
+            Utility::Directory::rm(temporary);
+    }
+
+    /* Whether the pixel data are large enough for the storage, pixel size
+       and image size in the header. A corrupted or truncated file is treated
+       as a cache miss instead of hitting an assertion in the ImageData
+       constructor. */
+    static bool isValid(const ImporterCacheImageHeader& header, const PixelStorage& storage, std::size_t dataSize) {
+        const std::pair<Math::Vector3<std::size_t>, Math::Vector3<std::size_t>> properties = storage.dataProperties(header.pixelSize, header.size);
+        const std::size_t offset = properties.first.sum();
+        if(offset > dataSize) return false;
+
+        std::size_t size = 1;
+        for(std::size_t i = 0; i != 3; ++i) {
+            if(properties.second[i] && size > (dataSize - offset)/properties.second[i])
+                return false;
+            size *= properties.second[i];
+        }
+        return size <= dataSize - offset;
+    }
+
+    static Containers::Optional<Trade::ImageData<dimensions>> load(const std::string& filename) {
+        Containers::Array<char> in = Utility::Directory::read(filename);
+        ImporterCacheImageHeader header;
+        if(in.size() < sizeof(header)) return {};
+        std::memcpy(&header, in.data(), sizeof(header));
+        if(std::memcmp(header.magic, "MIC1", 4) != 0 || header.dimensions != dimensions) return {};
+
+        /* Check the values the PixelStorage setters and the ImageData
+           constructor would assert on */
+        if(!header.pixelSize || header.pixelSize >= 256 ||
+           (header.alignment != 1 && header.alignment != 2 && header.alignment != 4 && header.alignment != 8) ||
+           header.rowLength < 0 || header.imageHeight < 0 ||
+           header.skip.min() < 0 || header.size.min() < 0)
+            return {};
+        const PixelStorage storage = PixelStorage{}
+            .setAlignment(header.alignment)
+            .setRowLength(header.rowLength)
+            .setImageHeight(header.imageHeight)
+            .setSkip(header.skip);
+        if(!isValid(header, storage, in.size() - sizeof(header))) return {};
+
+        Containers::Array<char> data{Containers::NoInit, in.size() - sizeof(header)};
+        if(data.size()) std::memcpy(data.data(), in.data() + sizeof(header), data.size());
+        return Trade::ImageData<dimensions>{storage,
+            PixelFormat(header.format), header.formatExtra, header.pixelSize,
+            VectorTypeFor<dimensions, Int>{Math::Vector<dimensions, Int>::pad(header.size)},
+            std::move(data)};
+    }
+};
+
+template<class Mesh, class T> std::vector<std::vector<T>> copyMeshArrays(const std::vector<T>&(Mesh::*get)(UnsignedInt) const, const Mesh& mesh, UnsignedInt count) {
+    std::vector<std::vector<T>> out;
+    for(UnsignedInt i = 0; i != count; ++i) out.push_back((mesh.*get)(i));
+    return out;
+}
+
+template<class Mesh, class T> std::size_t meshArraysSize(const std::vector<T>&(Mesh::*get)(UnsignedInt) const, const Mesh& mesh, UnsignedInt count) {
+    std::size_t size = 0;
+    for(UnsignedInt i = 0; i != count; ++i) size += (mesh.*get)(i).size()*sizeof(T);
+    return size;
+}
+
+/* Meshes are cached only in memory */
+template<> struct ImporterCacheTraits<Trade::MeshData2D> {
+    static std::size_t size(const Trade::MeshData2D& mesh) {
+        return (mesh.isIndexed() ? mesh.indices().size()*sizeof(UnsignedInt) : 0) +
+            meshArraysSize(&Trade::MeshData2D::positions, mesh, mesh.positionArrayCount()) +
+            meshArraysSize(&Trade::MeshData2D::textureCoords2D, mesh, mesh.textureCoords2DArrayCount()) +
+            meshArraysSize(&Trade::MeshData2D::colors, mesh, mesh.colorArrayCount());
+    }
+
+    static Trade::MeshData2D copy(const Trade::MeshData2D& mesh) {
+        return Trade::MeshData2D{mesh.primitive(),
+            mesh.isIndexed() ? mesh.indices() : std::vector<UnsignedInt>{},
+            copyMeshArrays(&Trade::MeshData2D::positions, mesh, mesh.positionArrayCount()),
+            copyMeshArrays(&Trade::MeshData2D::textureCoords2D, mesh, mesh.textureCoords2DArrayCount()),
+            copyMeshArrays(&Trade::MeshData2D::colors, mesh, mesh.colorArrayCount())};
+    }
+
+    static void save(const std::string&, const Trade::MeshData2D&) {}
+    static Containers::Optional<Trade::MeshData2D> load(const std::string&) { return {}; }
+};
+template<> struct ImporterCacheTraits<Trade::MeshData3D> {
+    static std::size_t size(const Trade::MeshData3D& mesh) {
+        return (mesh.isIndexed() ? mesh.indices().size()*sizeof(UnsignedInt) : 0) +
+            meshArraysSize(&Trade::MeshData3D::positions, mesh, mesh.positionArrayCount()) +
+            meshArraysSize(&Trade::MeshData3D::normals, mesh, mesh.normalArrayCount()) +
+            meshArraysSize(&Trade::MeshData3D::textureCoords2D, mesh, mesh.textureCoords2DArrayCount()) +
+            meshArraysSize(&Trade::MeshData3D::colors, mesh, mesh.colorArrayCount());
+    }
+
+    static Trade::MeshData3D copy(const Trade::MeshData3D& mesh) {
+        return Trade::MeshData3D{mesh.primitive(),
+            mesh.isIndexed() ? mesh.indices() : std::vector<UnsignedInt>{},
+            copyMeshArrays(&Trade::MeshData3D::positions, mesh, mesh.positionArrayCount()),
+            copyMeshArrays(&Trade::MeshData3D::normals, mesh, mesh.normalArrayCount()),
+            copyMeshArrays(&Trade::MeshData3D::textureCoords2D, mesh, mesh.textureCoords2DArrayCount()),
+            copyMeshArrays(&Trade::MeshData3D::colors, mesh, mesh.colorArrayCount())};
+    }
+
+    static void save(const std::string&, const Trade::MeshData3D&) {}
+    static Containers::Optional<Trade::MeshData3D> load(const std::string&) { return {}; }
+};
+
+template<class R, Containers::Optional<R>(Trade::AbstractImporter::*f)(UnsignedInt), UnsignedInt(Trade::AbstractImporter::*bounds)() const> R cachedResult(ImporterCache& self, Trade::AbstractImporter& importer, const std::string& filename, UnsignedInt id, const char* kind) {
+    checkNotBusy(importer);
+
+    /* The configuration and flags affect what the importer produces, so
+       they're a part of the key as well */
+    std::string options;
+    {
+        Utility::Configuration configuration;
+        configuration.addGroup("configuration", new Utility::ConfigurationGroup{importer.configuration()});
+        std::ostringstream out;
+        out << UnsignedInt(Trade::ImporterFlags::UnderlyingType(importer.flags())) << '\n';
+        configuration.save(out);
+        options = out.str();
+    }
+
+    /* Hashing the file is way cheaper than decoding it, so do that upfront */
+    std::string key;
+    {
+        py::gil_scoped_release release;
+        if(Utility::Directory::exists(filename)) {
+            const Containers::Array<char> contents = Utility::Directory::read(filename);
+            key = (Utility::Sha1{} << contents).digest().hexString() + '-' + importer.plugin() + '-' + (Utility::Sha1{} << options).digest().hexString() + '-' + kind + std::to_string(id);
+        }
+    }
+    if(key.empty()) {
+        PyErr_Format(PyExc_RuntimeError, "opening %s failed", filename.data());
+        throw py::error_already_set{};
+    }
+
+    if(py::object* cached = self.find(key))
+        return ImporterCacheTraits<R>::copy(py::cast<const R&>(*cached));
+
+    const std::string diskFilename = self.directory.empty() ? std::string{} : Utility::Directory::join(self.directory, key + ".bin");
+    Containers::Optional<R> out;
+    if(!diskFilename.empty()) {
+        py::gil_scoped_release release;
+        if(Utility::Directory::exists(diskFilename))
+            out = ImporterCacheTraits<R>::load(diskFilename);
+    }
+
+    /* Not cached anywhere, import the data. Uses a separate instance of the
+       same plugin so a file the caller has opened in the importer stays
+       untouched, with the same configuration and flags as the importer. The
+       instance is taken out of the cache while it's used, so another thread
+       doing a lookup meanwhile creates its own instead. */
+    if(!out) {
+        py::object& manager = pyObjectHolderFor<PluginManager::PyPluginHolder>(importer).manager;
+        std::unique_ptr<Trade::AbstractImporter> worker;
+        if(self.worker && self.workerManager.is(manager) && self.worker->plugin() == importer.plugin())
+            worker = std::move(self.worker);
+        else worker = std::move(batchWorkers(importer, 1, 1)[0]);
+        worker->configuration() = importer.configuration();
+        worker->setFlags(importer.flags());
+
+        Trade::AbstractImporter& workerImporter = *worker;
+        bool opened, inBounds = false;
+        {
+            py::gil_scoped_release release;
+            /** @todo log redirection, same as in the non-cached variants */
+            if((opened = workerImporter.openFile(filename))) {
+                if((inBounds = id < (workerImporter.*bounds)())) {
+                    out = (workerImporter.*f)(id);
+                    if(out && !diskFilename.empty())
+                        ImporterCacheTraits<R>::save(diskFilename, *out);
+                }
+                workerImporter.close();
+            }
+        }
+
+        /* Keep the instance for next time. The previous one has to go
+           before its manager is replaced. */
+        self.worker = nullptr;
+        self.workerManager = manager;
+        self.worker = std::move(worker);
+
+        if(!opened) {
+            PyErr_Format(PyExc_RuntimeError, "opening %s failed", filename.data());
+            throw py::error_already_set{};
+        }
+        if(!inBounds) {
+            PyErr_SetNone(PyExc_IndexError);
+            throw py::error_already_set{};
+        }
+    }
+    if(!out) {
+        PyErr_SetString(PyExc_RuntimeError, "import failed");
+        throw py::error_already_set{};
+    }
+
+    R result = ImporterCacheTraits<R>::copy(*out);
+    const std::size_t size = ImporterCacheTraits<R>::size(*out);
+    self.insert(key, size, py::cast(*std::move(out)));
+    return result;
+}
+
 }
 
 void trade(py::module& m) {
@@ -209,9 +1008,34 @@ void trade(py::module& m) {
 
     py::class_<Trade::MeshData2D> meshData2D{m, "MeshData2D", "Two-dimensional mesh data"};
     py::class_<Trade::MeshData3D> meshData3D{m, "MeshData3D", "Three-dimensional mesh data"};
-    meshData(meshData2D);
-    meshData(meshData3D);
-    meshData3D.def("has_normals", &Trade::MeshData3D::hasNormals, "Whether the data contain any normals");
+    meshData<Trade::MeshData2D, Vector2>(meshData2D);
+    meshData<Trade::MeshData3D, Vector3>(meshData3D);
+    meshData2D
+        .def(py::init([](MeshPrimitive primitive, const py::object& positions, const py::object& textureCoords2D, const py::object& colors, const py::object& indices) {
+            /* The mesh needs to have a position array even if empty */
+            std::vector<std::vector<Vector2>> positionArrays(1);
+            positionArrays[0] = vectorsFromBuffer<Vector2>(positions, "positions");
+            const std::size_t vertexCount = positionArrays[0].size();
+            return Trade::MeshData2D{primitive, indicesFromBuffer(indices),
+                std::move(positionArrays),
+                attributeArrays(vectorsFromBuffer<Vector2>(textureCoords2D, "texture_coords2d"), vertexCount, "texture coordinates"),
+                attributeArrays(vectorsFromBuffer<Color4>(colors, "colors"), vertexCount, "colors")};
+        }), "Construct from buffers", py::arg("primitive"), py::arg("positions"), py::arg("texture_coords2d") = py::none{}, py::arg("colors") = py::none{}, py::arg("indices") = py::none{});
+    meshData3D
+        .def(py::init([](MeshPrimitive primitive, const py::object& positions, const py::object& normals, const py::object& textureCoords2D, const py::object& colors, const py::object& indices) {
+            /* The mesh needs to have a position array even if empty */
+            std::vector<std::vector<Vector3>> positionArrays(1);
+            positionArrays[0] = vectorsFromBuffer<Vector3>(positions, "positions");
+            const std::size_t vertexCount = positionArrays[0].size();
+            return Trade::MeshData3D{primitive, indicesFromBuffer(indices),
+                std::move(positionArrays),
+                attributeArrays(vectorsFromBuffer<Vector3>(normals, "normals"), vertexCount, "normals"),
+                attributeArrays(vectorsFromBuffer<Vector2>(textureCoords2D, "texture_coords2d"), vertexCount, "texture coordinates"),
+                attributeArrays(vectorsFromBuffer<Color4>(colors, "colors"), vertexCount, "colors")};
+        }), "Construct from buffers", py::arg("primitive"), py::arg("positions"), py::arg("normals") = py::none{}, py::arg("texture_coords2d") = py::none{}, py::arg("colors") = py::none{}, py::arg("indices") = py::none{})
+        .def("has_normals", &Trade::MeshData3D::hasNormals, "Whether the data contain any normals")
+        .def_property_readonly("normal_array_count", &Trade::MeshData3D::normalArrayCount, "Count of normal arrays")
+        .def("normals", meshAttribute<Trade::MeshData3D, Vector3, &Trade::MeshData3D::normals, &Trade::MeshData3D::normalArrayCount>, "Normals", py::arg("id") = 0);
 
     py::class_<Trade::ImageData1D> imageData1D{m, "ImageData1D", "One-dimensional image data"};
     py::class_<Trade::ImageData2D> imageData2D{m, "ImageData2D", "Two-dimensional image data"};
@@ -224,28 +1048,93 @@ void trade(py::module& m) {
        void*. Leaving the name as AbstractImporter (instead of Importer) to
        avoid needless name differences and because in the future there *might*
        be pure Python importers (not now tho). */
+    importerIteratorClass<Trade::MeshData2D, &Trade::AbstractImporter::mesh2D>(m, "MeshData2DIterator", "Iterator over two-dimensional meshes in an importer");
+    importerIteratorClass<Trade::MeshData3D, &Trade::AbstractImporter::mesh3D>(m, "MeshData3DIterator", "Iterator over three-dimensional meshes in an importer");
+    importerIteratorClass<Trade::ImageData1D, &Trade::AbstractImporter::image1D>(m, "ImageData1DIterator", "Iterator over one-dimensional images in an importer");
+    importerIteratorClass<Trade::ImageData2D, &Trade::AbstractImporter::image2D>(m, "ImageData2DIterator", "Iterator over two-dimensional images in an importer");
+    importerIteratorClass<Trade::ImageData3D, &Trade::AbstractImporter::image3D>(m, "ImageData3DIterator", "Iterator over three-dimensional images in an importer");
+
+    py::class_<ImageBands2DIterator>{m, "ImageBands2DIterator", "Iterator over bands of rows of a two-dimensional image"}
+        .def("__iter__", [](py::object self) { return self; }, "Iterator")
+        .def("__next__", &ImageBands2DIterator::next, "Next band");
+
     py::class_<Trade::AbstractImporter, PluginManager::PyPluginHolder<Trade::AbstractImporter>> abstractImporter{m, "AbstractImporter", "Interface for importer plugins"};
     corrade::plugin(abstractImporter);
     abstractImporter
         /** @todo features (once moved outside of the importer) */
-        .def_property_readonly("is_opened", &Trade::AbstractImporter::isOpened, "Whether any file is opened")
-        .def("open_data", [](Trade::AbstractImporter& self, Containers::ArrayView<const char> data) {
+        .def_property_readonly("is_opened", [](Trade::AbstractImporter& self) {
+            checkNotBusy(self);
+            return self.isOpened();
+        }, "Whether any file is opened")
+        .def("open_data", [](Trade::AbstractImporter& self, const Containers::ArrayView<const char>& data, bool pin) {
+            checkNotBusy(self);
+
             /** @todo log redirection -- but we'd need assertions to not be
                 part of that so when it dies, the user can still see why */
-            if(self.openData(data)) return;
+            bool opened;
+            {
+                py::gil_scoped_release release;
+                opened = self.openData(data);
+            }
+
+            /* Any previously mapped file or pinned data is not referenced
+               anymore. If asked to, pin the memory owner for as long as the
+               importer is opened. This doesn't avoid the copy the plugin
+               makes in openData(), it only keeps the memory valid. The view
+               is taken by a reference in order to have access to its
+               holder. */
+            pyObjectHolderFor<PluginManager::PyPluginHolder>(self).data = opened && pin ? pyObjectHolderFor<Containers::PyArrayViewHolder>(data).owner : py::none{};
+            if(opened) return;
 
             PyErr_SetString(PyExc_RuntimeError, "opening data failed");
             throw py::error_already_set{};
-        }, "Open raw data", py::arg("data"))
-        .def("open_file", [](Trade::AbstractImporter& self, const std::string& filename) {
+        }, "Open raw data", py::arg("data"), py::arg("pin") = false)
+        .def("open_file", [](Trade::AbstractImporter& self, const std::string& filename, bool mmap) {
+            checkNotBusy(self);
+
             /** @todo log redirection -- but we'd need assertions to not be
                 part of that so when it dies, the user can still see why */
-            if(self.openFile(filename)) return;
+            py::object& data = pyObjectHolderFor<PluginManager::PyPluginHolder>(self).data;
+            bool opened;
+            if(mmap) {
+                #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+                MappedFile mapped;
+                {
+                    py::gil_scoped_release release;
+                    mapped = Utility::Directory::mapRead(filename);
+                    opened = mapped && self.openData(mapped);
+                }
+
+                /* Replace the previous file (if any) with the new mapping,
+                   the previous one is not referenced by the plugin anymore
+                   after openData() */
+                if(opened) {
+                    data = py::capsule{new MappedFile{std::move(mapped)}, deleteMappedFile};
+                    return;
+                }
+                #else
+                PyErr_SetString(PyExc_NotImplementedError, "memory-mapped files are not available on this platform");
+                throw py::error_already_set{};
+                #endif
+            } else {
+                py::gil_scoped_release release;
+                opened = self.openFile(filename);
+            }
+            data = py::none{};
+            if(opened) return;
 
             PyErr_Format(PyExc_RuntimeError, "opening %s failed", filename.data());
             throw py::error_already_set{};
-        }, "Open a file", py::arg("filename"))
-        .def("close", &Trade::AbstractImporter::close, "Close currently opened file")
+        }, "Open a file", py::arg("filename"), py::arg("mmap") = false)
+        .def("close", [](Trade::AbstractImporter& self) {
+            checkNotBusy(self);
+
+            {
+                py::gil_scoped_release release;
+                self.close();
+            }
+            pyObjectHolderFor<PluginManager::PyPluginHolder>(self).data = py::none{};
+        }, "Close currently opened file")
 
         /** @todo all other data types */
         .def_property_readonly("mesh2d_count", checkOpened<UnsignedInt, &Trade::AbstractImporter::mesh2DCount>, "Two-dimensional mesh count")
@@ -256,6 +1145,10 @@ void trade(py::module& m) {
         .def("mesh3d_name", checkOpenedBounds<std::string, &Trade::AbstractImporter::mesh3DName, &Trade::AbstractImporter::mesh3DCount>, "Three-dimensional mesh name", py::arg("id"))
         .def("mesh2d", checkOpenedBoundsResult<Trade::MeshData2D, &Trade::AbstractImporter::mesh2D, &Trade::AbstractImporter::mesh2DCount>, "Two-dimensional mesh", py::arg("id"))
         .def("mesh3d", checkOpenedBoundsResult<Trade::MeshData3D, &Trade::AbstractImporter::mesh3D, &Trade::AbstractImporter::mesh3DCount>, "Three-dimensional mesh", py::arg("id"))
+        .def("meshes2d", importerIterator<Trade::MeshData2D, &Trade::AbstractImporter::mesh2D, &Trade::AbstractImporter::mesh2DCount>, "Iterate over all two-dimensional meshes", py::arg("prefetch") = 2)
+        .def("meshes3d", importerIterator<Trade::MeshData3D, &Trade::AbstractImporter::mesh3D, &Trade::AbstractImporter::mesh3DCount>, "Iterate over all three-dimensional meshes", py::arg("prefetch") = 2)
+        .def("mesh2d_batch", checkBatchResult<Trade::MeshData2D, &Trade::AbstractImporter::mesh2D, &Trade::AbstractImporter::mesh2DCount>, "Two-dimensional mesh from a batch of files", py::arg("filenames"), py::arg("id") = 0, py::arg("threads") = 0)
+        .def("mesh3d_batch", checkBatchResult<Trade::MeshData3D, &Trade::AbstractImporter::mesh3D, &Trade::AbstractImporter::mesh3DCount>, "Three-dimensional mesh from a batch of files", py::arg("filenames"), py::arg("id") = 0, py::arg("threads") = 0)
 
         .def_property_readonly("image1d_count", checkOpened<UnsignedInt, &Trade::AbstractImporter::image1DCount>, "One-dimensional image count")
         .def_property_readonly("image2d_count", checkOpened<UnsignedInt, &Trade::AbstractImporter::image2DCount>, "Two-dimensional image count")
@@ -268,10 +1161,97 @@ void trade(py::module& m) {
         .def("image3d_name", checkOpenedBounds<std::string, &Trade::AbstractImporter::image3DName, &Trade::AbstractImporter::image3DCount>, "Three-dimensional image name", py::arg("id"))
         .def("image1d", checkOpenedBoundsResult<Trade::ImageData1D, &Trade::AbstractImporter::image1D, &Trade::AbstractImporter::image1DCount>, "One-dimensional image", py::arg("id"))
         .def("image2d", checkOpenedBoundsResult<Trade::ImageData2D, &Trade::AbstractImporter::image2D, &Trade::AbstractImporter::image2DCount>, "Two-dimensional image", py::arg("id"))
-        .def("image3d", checkOpenedBoundsResult<Trade::ImageData3D, &Trade::AbstractImporter::image3D, &Trade::AbstractImporter::image3DCount>, "Three-dimensional image", py::arg("id"));
+        .def("image3d", checkOpenedBoundsResult<Trade::ImageData3D, &Trade::AbstractImporter::image3D, &Trade::AbstractImporter::image3DCount>, "Three-dimensional image", py::arg("id"))
+        .def("images1d", importerIterator<Trade::ImageData1D, &Trade::AbstractImporter::image1D, &Trade::AbstractImporter::image1DCount>, "Iterate over all one-dimensional images", py::arg("prefetch") = 2)
+        .def("images2d", importerIterator<Trade::ImageData2D, &Trade::AbstractImporter::image2D, &Trade::AbstractImporter::image2DCount>, "Iterate over all two-dimensional images", py::arg("prefetch") = 2)
+        .def("images3d", importerIterator<Trade::ImageData3D, &Trade::AbstractImporter::image3D, &Trade::AbstractImporter::image3DCount>, "Iterate over all three-dimensional images", py::arg("prefetch") = 2)
+        .def("image1d_batch", checkBatchResult<Trade::ImageData1D, &Trade::AbstractImporter::image1D, &Trade::AbstractImporter::image1DCount>, "One-dimensional image from a batch of files", py::arg("filenames"), py::arg("id") = 0, py::arg("threads") = 0)
+        .def("image2d_bands", imageBands2D, "Iterate over a two-dimensional image in bands of rows, decoding it whole first", py::arg("id"), py::arg("rows"))
+        .def("image2d_batch", checkBatchResult<Trade::ImageData2D, &Trade::AbstractImporter::image2D, &Trade::AbstractImporter::image2DCount>, "Two-dimensional image from a batch of files", py::arg("filenames"), py::arg("id") = 0, py::arg("threads") = 0)
+        .def("image3d_batch", checkBatchResult<Trade::ImageData3D, &Trade::AbstractImporter::image3D, &Trade::AbstractImporter::image3DCount>, "Three-dimensional image from a batch of files", py::arg("filenames"), py::arg("id") = 0, py::arg("threads") = 0);
 
     py::class_<PluginManager::Manager<Trade::AbstractImporter>, PluginManager::AbstractManager> importerManager{m, "ImporterManager", "Plugin manager for importer plugins"};
     corrade::manager(importerManager);
+
+    py::class_<PluginManager::PyPluginPool<Trade::AbstractImporter>, std::shared_ptr<PluginManager::PyPluginPool<Trade::AbstractImporter>>> importerPool{m, "ImporterPool", "Pool of importer plugin instances"};
+    corrade::managerPool(importerManager, importerPool, closeImporter);
+
+    /* Image converter. Only the uncompressed 2D image APIs are exposed at the
+       moment. */
+    py::class_<Trade::AbstractImageConverter, PluginManager::PyPluginHolder<Trade::AbstractImageConverter>> abstractImageConverter{m, "AbstractImageConverter", "Interface for image converter plugins"};
+    corrade::plugin(abstractImageConverter);
+    abstractImageConverter
+        .def("export_to_data", [](Trade::AbstractImageConverter& self, const ImageView2D& image) {
+            /** @todo log redirection -- but we'd need assertions to not be
+                part of that so when it dies, the user can still see why */
+            Containers::Array<char> out;
+            {
+                py::gil_scoped_release release;
+                out = withDefaultDeleter(self.exportToData(image));
+            }
+            if(!out) {
+                PyErr_SetString(PyExc_RuntimeError, "export failed");
+                throw py::error_already_set{};
+            }
+
+            return out;
+        }, "Export an image to raw data", py::arg("image"))
+        .def("export_to_file", [](Trade::AbstractImageConverter& self, const ImageView2D& image, const std::string& filename) {
+            /** @todo log redirection -- but we'd need assertions to not be
+                part of that so when it dies, the user can still see why */
+            bool exported;
+            {
+                py::gil_scoped_release release;
+                exported = self.exportToFile(image, filename);
+            }
+            if(exported) return;
+
+            PyErr_Format(PyExc_RuntimeError, "exporting to %s failed", filename.data());
+            throw py::error_already_set{};
+        }, "Export an image to a file", py::arg("image"), py::arg("filename"))
+        .def("export_to_files", exportToFilesBatch, "Export a batch of images to files in parallel", py::arg("images"), py::arg("filenames"), py::arg("threads") = 0);
+
+    py::class_<PluginManager::Manager<Trade::AbstractImageConverter>, PluginManager::AbstractManager> imageConverterManager{m, "ImageConverterManager", "Plugin manager for image converter plugins"};
+    corrade::manager(imageConverterManager);
+
+    py::class_<ImporterCache> importerCache{m, "ImporterCache", "Cache for decoded importer data"};
+    importerCache
+        .def(py::init([](std::size_t maxSize, const std::string& directory) {
+            if(!directory.empty() && !Utility::Directory::mkpath(directory)) {
+                PyErr_Format(PyExc_RuntimeError, "can't create %s", directory.data());
+                throw py::error_already_set{};
+            }
+
+            return new ImporterCache{maxSize, directory};
+        }), "Constructor", py::arg("max_size") = 64*1024*1024, py::arg("directory") = std::string{})
+        .def_property_readonly("max_size", [](ImporterCache& self) {
+            return self.maxSize;
+        }, "Max size of data cached in memory (in bytes)")
+        .def_property_readonly("directory", [](ImporterCache& self) {
+            return self.directory;
+        }, "Directory for the on-disk cache")
+        .def_property_readonly("size", [](ImporterCache& self) {
+            return self.currentSize;
+        }, "Size of data cached in memory (in bytes)")
+        .def("__len__", [](ImporterCache& self) {
+            return self.entries.size();
+        }, "Count of items cached in memory")
+        .def("clear", &ImporterCache::clear, "Clear the in-memory cache")
+        .def("mesh2d", [](ImporterCache& self, Trade::AbstractImporter& importer, const std::string& filename, UnsignedInt id) {
+            return cachedResult<Trade::MeshData2D, &Trade::AbstractImporter::mesh2D, &Trade::AbstractImporter::mesh2DCount>(self, importer, filename, id, "mesh2d");
+        }, "Cached two-dimensional mesh", py::arg("importer"), py::arg("filename"), py::arg("id") = 0)
+        .def("mesh3d", [](ImporterCache& self, Trade::AbstractImporter& importer, const std::string& filename, UnsignedInt id) {
+            return cachedResult<Trade::MeshData3D, &Trade::AbstractImporter::mesh3D, &Trade::AbstractImporter::mesh3DCount>(self, importer, filename, id, "mesh3d");
+        }, "Cached three-dimensional mesh", py::arg("importer"), py::arg("filename"), py::arg("id") = 0)
+        .def("image1d", [](ImporterCache& self, Trade::AbstractImporter& importer, const std::string& filename, UnsignedInt id) {
+            return cachedResult<Trade::ImageData1D, &Trade::AbstractImporter::image1D, &Trade::AbstractImporter::image1DCount>(self, importer, filename, id, "image1d");
+        }, "Cached one-dimensional image", py::arg("importer"), py::arg("filename"), py::arg("id") = 0)
+        .def("image2d", [](ImporterCache& self, Trade::AbstractImporter& importer, const std::string& filename, UnsignedInt id) {
+            return cachedResult<Trade::ImageData2D, &Trade::AbstractImporter::image2D, &Trade::AbstractImporter::image2DCount>(self, importer, filename, id, "image2d");
+        }, "Cached two-dimensional image", py::arg("importer"), py::arg("filename"), py::arg("id") = 0)
+        .def("image3d", [](ImporterCache& self, Trade::AbstractImporter& importer, const std::string& filename, UnsignedInt id) {
+            return cachedResult<Trade::ImageData3D, &Trade::AbstractImporter::image3D, &Trade::AbstractImporter::image3DCount>(self, importer, filename, id, "image3d");
+        }, "Cached three-dimensional image", py::arg("importer"), py::arg("filename"), py::arg("id") = 0);
 }
 
 }